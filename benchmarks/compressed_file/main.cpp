@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* system header */
+#if defined __unix__ || defined __APPLE__
+  #include <time.h>
+#endif
+
+/* stl header */
+#include <chrono>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/* modern.cpp.logger */
+#include <Compression.h>
+#include <LoggerFactory.h>
+
+/**
+ * @brief Number of records per measurement.
+ */
+constexpr std::size_t records = 300000;
+
+/**
+ * @brief CPU time of the calling thread.
+ * @return CPU time.
+ */
+static std::chrono::nanoseconds threadTime() {
+
+#if defined __unix__ || defined __APPLE__
+  timespec time {};
+  ::clock_gettime( CLOCK_THREAD_CPUTIME_ID, &time );
+  return std::chrono::seconds( time.tv_sec ) + std::chrono::nanoseconds( time.tv_nsec );
+#else
+  return std::chrono::nanoseconds( 0 );
+#endif
+}
+
+/**
+ * @brief Size of the log file and of all rotated files.
+ * @param _filename   Log file.
+ * @return Size in bytes.
+ */
+static std::uintmax_t filesSize( const std::string &_filename ) {
+
+  std::uintmax_t size = 0;
+  const std::filesystem::path path( _filename );
+  for ( const auto &entry : std::filesystem::directory_iterator( path.parent_path() ) ) {
+
+    if ( entry.path().filename().string().starts_with( path.filename().string() ) ) {
+
+      size += entry.file_size();
+    }
+  }
+  return size;
+}
+
+/**
+ * @brief Remove the log file and all rotated files.
+ * @param _filename   Log file.
+ */
+static void removeFiles( const std::string &_filename ) {
+
+  const std::filesystem::path path( _filename );
+  for ( const auto &entry : std::filesystem::directory_iterator( path.parent_path() ) ) {
+
+    if ( entry.path().filename().string().starts_with( path.filename().string() ) ) {
+
+      std::filesystem::remove( entry.path() );
+    }
+  }
+}
+
+/**
+ * @brief Write the records and print the throughput of the uncompressed text, the CPU time of the logging thread and the ratio.
+ * @param _compression   Codec.
+ * @param _mode   Compression mode, stream or rotated.
+ * @param _messages   Messages of the records.
+ * @param _filename   Log file.
+ * @param _plain   Size of the uncompressed records, zero measures them.
+ * @return Size of the written files.
+ */
+static std::uintmax_t measure( const std::string &_compression,
+                               const std::string &_mode,
+                               const std::vector<std::string> &_messages,
+                               const std::string &_filename,
+                               std::uintmax_t _plain ) {
+
+  removeFiles( _filename );
+  std::unique_ptr<vx::Logger> logger = vx::LoggerFactory::instance().produce( { { "type", "file" }, { "filename", _filename }, { "compression", _compression }, { "compression_mode", _mode }, { "max_size", "8388608" } } );
+
+  const auto start = std::chrono::steady_clock::now();
+  const auto startCpu = threadTime();
+  for ( const std::string &message : _messages ) {
+
+    logger->log( message, vx::Severity::Info );
+  }
+  logger->flush();
+  const auto cpu = threadTime() - startCpu;
+  const auto wall = std::chrono::steady_clock::now() - start;
+
+  /* the rotated files are compressed in the background, the last one when the logger is destroyed */
+  logger.reset();
+
+  const std::uintmax_t size = filesSize( _filename );
+  const std::uintmax_t plain = _plain > 0 ? _plain : size;
+  /* with compression_mode rotated the current file stays plain, the ratio is the one of the rotated files */
+  const std::uintmax_t current = _mode == "rotated" ? std::filesystem::file_size( _filename ) : 0;
+  const std::string name = _compression + ", " + _mode;
+  const double seconds = std::chrono::duration<double>( wall ).count();
+  std::cout << std::left << std::setw( 40 ) << "Throughput (" + name + ")" << std::right << std::setw( 12 ) << std::fixed << std::setprecision( 1 ) << static_cast<double>( plain ) / ( 1024.0 * 1024.0 ) / seconds << " MB/s" << std::endl;
+  std::cout << std::left << std::setw( 40 ) << "Logging thread CPU (" + name + ")" << std::right << std::setw( 12 ) << std::fixed << std::setprecision( 1 ) << 1e9 * std::chrono::duration<double>( cpu ).count() / static_cast<double>( _messages.size() ) << " ns/record" << std::endl;
+  std::cout << std::left << std::setw( 40 ) << "Ratio (" + name + ")" << std::right << std::setw( 12 ) << std::fixed << std::setprecision( 1 ) << static_cast<double>( plain - current ) / static_cast<double>( size - current ) << " x" << std::endl;
+  removeFiles( _filename );
+  return size;
+}
+
+int main() {
+
+  /* typical access log records, the numbers change from record to record */
+  std::vector<std::string> messages {};
+  messages.reserve( records );
+  for ( std::size_t i = 0; i < records; ++i ) {
+
+    messages.push_back( "user " + std::to_string( i % 997 ) + " requested /api/v1/items/" + std::to_string( i % 4093 ) + " from 10.0." + std::to_string( i % 251 ) + "." + std::to_string( i % 13 ) + " status 200 in " + std::to_string( i % 89 ) + " ms" );
+  }
+
+  const std::string filename = ( std::filesystem::temp_directory_path() / "benchmark_compressed.log" ).string();
+  const std::uintmax_t plain = measure( "none", "stream", messages, filename, 0 );
+  for ( const auto &[ name, codec ] : { std::pair { "lz4", vx::compression::Codec::Lz4 }, std::pair { "zstd", vx::compression::Codec::Zstd }, std::pair { "gzip", vx::compression::Codec::Gzip } } ) {
+
+    if ( !vx::compression::available( codec ) ) {
+
+      std::cout << name << " is not built in." << std::endl;
+      continue;
+    }
+    measure( name, "stream", messages, filename, plain );
+    measure( name, "rotated", messages, filename, plain );
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* stl header */
+#include <sstream>
+#include <string>
+
+/* modern.cpp.logger */
+#include <LoggerFactory.h>
+
+/* local header */
+#include "../shared/BenchmarkHelper.h"
+
+/**
+ * @brief Number of calls per measurement, the queue is large enough to never block.
+ */
+constexpr std::size_t iterations = 100000;
+
+int main() {
+
+  /* /dev/null sink, so only the caller side is measured */
+  vx::ConfigureLogger( { { "type", "async" }, { "sink", "" }, { "queue", "thread" }, { "queue_capacity", "262144" } } );
+
+  int user = 0;
+  double latency = 0.25;
+  vx::BenchmarkHelper::print( "LogInfo (message built by caller)", vx::BenchmarkHelper::nanosecondsPerCall( iterations, [ &user, &latency ] {
+    std::ostringstream stream {};
+    stream << "user=" << ++user << " latency=" << latency << "us";
+    vx::LogInfo( stream.str() );
+  } ) );
+  const std::string name( "name" );
+  vx::BenchmarkHelper::print( "LogInfo (formatted by caller)", vx::BenchmarkHelper::nanosecondsPerCall( iterations, [ &user, &latency, &name ] {
+    vx::LogInfo( "user={} name={} latency={}us", ++user, name, latency );
+  } ) );
+  vx::BenchmarkHelper::print( "LogInfo (deferred formatting)", vx::BenchmarkHelper::nanosecondsPerCall( iterations, [ &user, &latency ] {
+    vx::LogInfo( "user={} latency={}us", ++user, latency );
+  } ) );
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* stl header */
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/* modern.cpp.logger */
+#include <LoggerFactory.h>
+
+/* local header */
+#include "../shared/BenchmarkHelper.h"
+
+/**
+ * @brief Number of records of all threads together.
+ */
+constexpr std::size_t records = 400000;
+
+/**
+ * @brief Number of threads of the last measurement, more than cores, so records wait for the disk write.
+ */
+constexpr unsigned int oversubscribedThreads = 32;
+
+/**
+ * @brief Number of write syscalls of the process so far (Linux only).
+ * @return Number of write syscalls or zero.
+ */
+static std::size_t writeCalls() {
+
+  std::ifstream io( "/proc/self/io" );
+  for ( std::string key {}; io >> key; ) {
+
+    std::size_t value = 0;
+    io >> value;
+    if ( key == "syscw:" ) {
+
+      return value;
+    }
+  }
+  return 0;
+}
+
+/**
+ * @brief Log from threads through the file mode and print the cost per record and the write syscalls per 1000 records.
+ * @param _name   Name of the configuration.
+ * @param _configuration   File logger configuration, without type and filename.
+ * @param _threads   Number of threads.
+ * @param _filename   Log file.
+ */
+static void measure( const std::string &_name,
+                     std::unordered_map<std::string, std::string> _configuration,
+                     unsigned int _threads,
+                     const std::string &_filename ) {
+
+  std::filesystem::remove( _filename );
+  _configuration[ "type" ] = "file";
+  _configuration[ "filename" ] = _filename;
+  vx::ConfigureLogger( _configuration );
+
+  const std::size_t perThread = records / _threads;
+  const std::size_t startCalls = writeCalls();
+  const double nanoseconds = vx::BenchmarkHelper::nanosecondsPerCall( 1, [ &_threads, &perThread ] {
+    std::vector<std::thread> threads {};
+    threads.reserve( _threads );
+    for ( unsigned int n = 0; n < _threads; ++n ) {
+
+      threads.emplace_back( [ &perThread ] {
+        for ( std::size_t i = 0; i < perThread; ++i ) {
+
+          vx::LogInfo( "This is a log message" );
+        }
+      } );
+    }
+    for ( auto &thread : threads ) {
+
+      thread.join();
+    }
+  } );
+  vx::FlushLogger();
+  /* the warm up logs the records once more */
+  const std::size_t calls = writeCalls() - startCalls;
+  vx::ConfigureLogger( { { "type", "" } } );
+
+  const std::string name = _name + ", " + std::to_string( _threads ) + " threads";
+  vx::BenchmarkHelper::print( "LogInfo (" + name + ")", nanoseconds / static_cast<double>( perThread * _threads ) );
+  std::cout << std::left << std::setw( 40 ) << "Writes/1000 records (" + name + ")" << std::right << std::setw( 12 ) << std::fixed << std::setprecision( 1 ) << 1000.0 * static_cast<double>( calls ) / static_cast<double>( 2 * perThread * _threads ) << std::endl;
+  std::filesystem::remove( _filename );
+}
+
+int main() {
+
+  const std::string filename = ( std::filesystem::temp_directory_path() / "benchmark.log" ).string();
+  const unsigned int hardwareThreadCount = std::max<unsigned int>( 1, std::thread::hardware_concurrency() );
+  for ( unsigned int threads = 1;; threads = std::min( threads * 2, hardwareThreadCount ) ) {
+
+    measure( "stream", { { "mode", "stream" } }, threads, filename );
+    measure( "append", { { "mode", "append" } }, threads, filename );
+
+    /* every record is in the file, when log returns */
+    measure( "unbuffered", { { "mode", "stream" }, { "buffer_size", "0" } }, threads, filename );
+    measure( "group", { { "mode", "group" } }, threads, filename );
+    if ( threads == hardwareThreadCount ) {
+
+      break;
+    }
+  }
+  measure( "unbuffered", { { "mode", "stream" }, { "buffer_size", "0" } }, oversubscribedThreads, filename );
+  measure( "group", { { "mode", "group" } }, oversubscribedThreads, filename );
+  measure( "group sync", { { "mode", "group" }, { "group_sync", "true" } }, oversubscribedThreads, filename );
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* stl header */
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+/* modern.cpp.logger */
+#include <LoggerFactory.h>
+
+/* local header */
+#include "../shared/BenchmarkHelper.h"
+
+/**
+ * @brief Number of calls per measurement.
+ */
+constexpr std::size_t iterations = 1000000;
+
+/**
+ * @brief Log message itself.
+ */
+constexpr auto logMessage = "This is a log message";
+
+/**
+ * @brief Former global logger access - every call produced and dropped a logger.
+ * @param _message   Message to log.
+ * @param _configuration   Configuration for logger.
+ */
+static void legacyLogInfo( const std::string &_message,
+                           const std::unordered_map<std::string, std::string> &_configuration = { { "type", "" } } ) {
+
+#ifdef __clang__
+  #pragma clang diagnostic push
+  #pragma clang diagnostic ignored "-Wexit-time-destructors"
+#endif
+  std::unique_ptr<vx::Logger> logger = vx::LoggerFactory::instance().produce( _configuration );
+  static std::unique_ptr<vx::Logger> singleton( std::move( logger ) );
+#ifdef __clang__
+  #pragma clang diagnostic pop
+#endif
+  singleton->log( _message, vx::Severity::Info );
+}
+
+int main() {
+
+  /* /dev/null logger, so only the path to the logger is measured */
+  vx::ConfigureLogger( { { "type", "" } } );
+
+  const std::string message( logMessage );
+  vx::BenchmarkHelper::print( "LogInfo (logger produced per call)", vx::BenchmarkHelper::nanosecondsPerCall( iterations, [ &message ] { legacyLogInfo( message ); } ) );
+  vx::BenchmarkHelper::print( "LogInfo (cached global logger)", vx::BenchmarkHelper::nanosecondsPerCall( iterations, [ &message ] { vx::LogInfo( message ); } ) );
+  return EXIT_SUCCESS;
+}
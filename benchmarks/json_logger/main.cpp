@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* stl header */
+#include <filesystem>
+#include <string>
+
+/* modern.cpp.logger */
+#include <LoggerFactory.h>
+
+/* local header */
+#include "../shared/BenchmarkHelper.h"
+
+/**
+ * @brief Number of calls per measurement.
+ */
+constexpr std::size_t iterations = 100000;
+
+/**
+ * @brief Records per call.
+ */
+constexpr std::size_t recordsPerCall = 3;
+
+/**
+ * @brief Log through the logger type and print the cost per call, the record size and the throughput.
+ * @param _type   Logger type.
+ * @param _filename   Log file.
+ */
+static void measure( const std::string &_type,
+                     const std::string &_filename ) {
+
+  std::filesystem::remove( _filename );
+  vx::ConfigureLogger( { { "type", _type }, { "filename", _filename } } );
+
+  int user = 0;
+  double latency = 0.25;
+  const double nanoseconds = vx::BenchmarkHelper::nanosecondsPerCall( iterations, [ &user, &latency ] {
+    vx::LogInfo( "user={} latency={}us", ++user, latency );
+    vx::LogInfo( "This is a log message" );
+    vx::LogInfo( "Query \"{}\" returned {} rows", "SELECT * FROM orders WHERE status = 'open'", user );
+  } );
+  vx::BenchmarkHelper::print( "LogInfo x3 (" + _type + ")", nanoseconds );
+  vx::ConfigureLogger( { { "type", "" } } );
+
+  /* the warm up call writes the records once more */
+  const auto bytes = static_cast<double>( std::filesystem::file_size( _filename ) );
+  const double records = static_cast<double>( ( iterations + 1 ) * recordsPerCall );
+  std::cout << std::left << std::setw( 40 ) << "Record size (" + _type + ")" << std::right << std::setw( 12 ) << std::fixed << std::setprecision( 1 ) << bytes / records << " bytes" << std::endl;
+  std::cout << std::left << std::setw( 40 ) << "Throughput (" + _type + ")" << std::right << std::setw( 12 ) << std::fixed << std::setprecision( 1 ) << bytes / ( nanoseconds * static_cast<double>( iterations + 1 ) / 1000.0 ) << " MB/s" << std::endl;
+  std::filesystem::remove( _filename );
+}
+
+int main() {
+
+  const std::filesystem::path tmpPath = std::filesystem::temp_directory_path();
+  measure( "file", ( tmpPath / "benchmark.log" ).string() );
+  measure( "xml", ( tmpPath / "benchmark.xml" ).string() );
+  measure( "json", ( tmpPath / "benchmark.json" ).string() );
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* stl header */
+#include <string>
+
+/* magic enum */
+#include <magic_enum.hpp>
+
+/* modern.cpp.core */
+#include <StringUtils.h>
+
+/* modern.cpp.logger */
+#include <SeverityLabel.h>
+
+/* local header */
+#include "../shared/BenchmarkHelper.h"
+
+/**
+ * @brief Number of calls per measurement.
+ */
+constexpr std::size_t iterations = 1000000;
+
+/**
+ * @brief Former label of a colored log line.
+ * @param _output   Log line.
+ * @param _severity   Severity level.
+ */
+static void legacyLabel( std::string &_output,
+                         vx::Severity _severity ) {
+
+  std::string severity( magic_enum::enum_name( _severity ) );
+  vx::string_utils::toUpper( severity );
+  switch ( _severity ) {
+
+    case vx::Severity::Verbose:
+      _output.append( " \x1b[37;1m[" + severity + "]\x1b[0m " );
+      break;
+    case vx::Severity::Debug:
+      _output.append( " \x1b[34;1m[" + severity + "]\x1b[0m " );
+      break;
+    case vx::Severity::Info:
+      _output.append( " \x1b[32;1m[" + severity + "]\x1b[0m " );
+      break;
+    case vx::Severity::Warning:
+      _output.append( " \x1b[33;1m[" + severity + "]\x1b[0m " );
+      break;
+    case vx::Severity::Error:
+      _output.append( " \x1b[31;1m[" + severity + "]\x1b[0m " );
+      break;
+    case vx::Severity::Fatal:
+      _output.append( " \x1b[41;1m[" + severity + "]\x1b[0m " );
+      break;
+  }
+}
+
+int main() {
+
+  std::string output {};
+  output.reserve( 64 );
+  std::size_t index = 0;
+  const auto next = [ &index ] { return magic_enum::enum_values<vx::Severity>()[ index++ % magic_enum::enum_count<vx::Severity>() ]; };
+
+  vx::BenchmarkHelper::print( "Label (enum name, upper, concatenation)", vx::BenchmarkHelper::nanosecondsPerCall( iterations, [ &output, &next ] {
+    output.clear();
+    legacyLabel( output, next() );
+  } ) );
+  vx::BenchmarkHelper::print( "Label (constexpr table)", vx::BenchmarkHelper::nanosecondsPerCall( iterations, [ &output, &next ] {
+    output.clear();
+    output.append( vx::severityLabel( next(), true ) );
+  } ) );
+  return output.empty() ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+/* stl header */
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string_view>
+
+namespace vx::BenchmarkHelper {
+
+  /**
+   * @brief Measure the average duration of a call.
+   * @param _iterations   Number of calls.
+   * @param _function   Function to measure.
+   * @return Nanoseconds per call.
+   */
+  template <typename Function>
+  double nanosecondsPerCall( std::size_t _iterations,
+                             Function &&_function ) {
+
+    /* warm up, so lazy initialization is not measured */
+    _function();
+
+    const auto start = std::chrono::steady_clock::now();
+    for ( std::size_t i = 0; i < _iterations; ++i ) {
+
+      _function();
+    }
+    const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now() - start );
+    return static_cast<double>( duration.count() ) / static_cast<double>( _iterations );
+  }
+
+  /**
+   * @brief Print one result line.
+   * @param _name   Name of the measured path.
+   * @param _nanoseconds   Nanoseconds per call.
+   */
+  inline void print( std::string_view _name,
+                     double _nanoseconds ) {
+
+    std::cout << std::left << std::setw( 40 ) << _name << std::right << std::setw( 12 ) << std::fixed << std::setprecision( 1 ) << _nanoseconds << " ns/call" << std::endl;
+  }
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* system header */
+#if defined __unix__ || defined __APPLE__
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
+
+/* stl header */
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/* modern.cpp.logger */
+#include <LoggerFactory.h>
+
+/* local header */
+#include "../shared/BenchmarkHelper.h"
+
+/**
+ * @brief Number of calls per measurement.
+ */
+constexpr std::size_t iterations = 200000;
+
+/**
+ * @brief Log message itself.
+ */
+constexpr auto logMessage = "This is a log message";
+
+/**
+ * @brief Number of write syscalls of the process so far (Linux only).
+ * @return Number of write syscalls or zero.
+ */
+static std::size_t writeCalls() {
+
+  std::ifstream io( "/proc/self/io" );
+  for ( std::string key {}; io >> key; ) {
+
+    std::size_t value = 0;
+    io >> value;
+    if ( key == "syscw:" ) {
+
+      return value;
+    }
+  }
+  return 0;
+}
+
+int main() {
+
+#if defined __unix__ || defined __APPLE__
+  /* stdout goes to a file, like the log transport of a container */
+  const std::string filename = ( std::filesystem::temp_directory_path() / "benchmark_stdout.log" ).string();
+  const int file = ::open( filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644 );
+  const int terminal = ::dup( STDOUT_FILENO );
+  if ( file < 0 || terminal < 0 ) {
+
+    return EXIT_FAILURE;
+  }
+
+  const std::vector<std::pair<std::string, std::unordered_map<std::string, std::string>>> configurations {
+    { "stream", { { "type", "std" } } },
+    { "direct, flush line", { { "type", "std" }, { "mode", "direct" }, { "flush", "line" } } },
+    { "direct, flush auto", { { "type", "std" }, { "mode", "direct" } } }
+  };
+  std::vector<std::pair<double, double>> results {};
+  for ( const auto &[ name, configuration ] : configurations ) {
+
+    std::cout.flush();
+    ::dup2( file, STDOUT_FILENO );
+    vx::ConfigureLogger( configuration );
+    const std::size_t startCalls = writeCalls();
+    const double nanoseconds = vx::BenchmarkHelper::nanosecondsPerCall( iterations, [] { vx::LogInfo( logMessage ); } );
+    vx::FlushLogger();
+    /* the warm up logs one record more */
+    const std::size_t calls = writeCalls() - startCalls;
+    vx::ConfigureLogger( { { "type", "" } } );
+    std::cout.flush();
+    ::dup2( terminal, STDOUT_FILENO );
+    results.emplace_back( nanoseconds, 1000.0 * static_cast<double>( calls ) / static_cast<double>( iterations + 1 ) );
+  }
+  ::close( terminal );
+  ::close( file );
+  std::filesystem::remove( filename );
+
+  for ( std::size_t index = 0; index < configurations.size(); ++index ) {
+
+    vx::BenchmarkHelper::print( "LogInfo (" + configurations[ index ].first + ")", results[ index ].first );
+    std::cout << std::left << std::setw( 40 ) << "Writes/1000 records (" + configurations[ index ].first + ")" << std::right << std::setw( 12 ) << std::fixed << std::setprecision( 1 ) << results[ index ].second << std::endl;
+  }
+#endif
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* system header */
+#if defined __unix__ || defined __APPLE__
+  #include <time.h>
+#endif
+
+/* stl header */
+#include <chrono>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+/* modern.cpp.logger */
+#include <LoggerFactory.h>
+
+/**
+ * @brief Number of records per measurement.
+ */
+constexpr std::size_t records = 300000;
+
+/**
+ * @brief Size of the message of a record.
+ */
+constexpr std::size_t messageSize = 200;
+
+/**
+ * @brief CPU time of the calling thread, it plays the backend of an async logger.
+ * @return CPU time.
+ */
+static std::chrono::nanoseconds threadTime() {
+
+#if defined __unix__ || defined __APPLE__
+  timespec time {};
+  ::clock_gettime( CLOCK_THREAD_CPUTIME_ID, &time );
+  return std::chrono::seconds( time.tv_sec ) + std::chrono::nanoseconds( time.tv_nsec );
+#else
+  return std::chrono::nanoseconds( 0 );
+#endif
+}
+
+/**
+ * @brief Write the records through the file mode and print the throughput and the CPU time of the writing thread.
+ * @param _mode   File mode.
+ * @param _filename   Log file.
+ */
+static void measure( const std::string &_mode,
+                     const std::string &_filename ) {
+
+  std::filesystem::remove( _filename );
+  std::unique_ptr<vx::Logger> logger = vx::LoggerFactory::instance().produce( { { "type", "file" }, { "filename", _filename }, { "mode", _mode } } );
+  const std::string message( messageSize, 'x' );
+
+  const auto start = std::chrono::steady_clock::now();
+  const auto startCpu = threadTime();
+  for ( std::size_t i = 0; i < records; ++i ) {
+
+    logger->log( message, vx::Severity::Info );
+  }
+  logger->flush();
+  const auto cpu = threadTime() - startCpu;
+  const auto wall = std::chrono::steady_clock::now() - start;
+  logger.reset();
+
+  const double seconds = std::chrono::duration<double>( wall ).count();
+  const double megabytes = static_cast<double>( std::filesystem::file_size( _filename ) ) / ( 1024.0 * 1024.0 );
+  std::cout << std::left << std::setw( 40 ) << "Throughput (" + _mode + ")" << std::right << std::setw( 12 ) << std::fixed << std::setprecision( 1 ) << megabytes / seconds << " MB/s" << std::endl;
+  std::cout << std::left << std::setw( 40 ) << "Writing thread CPU (" + _mode + ")" << std::right << std::setw( 12 ) << std::fixed << std::setprecision( 1 ) << 100.0 * std::chrono::duration<double>( cpu ).count() / seconds << " %" << std::endl;
+  std::filesystem::remove( _filename );
+}
+
+int main() {
+
+  const std::string filename = ( std::filesystem::temp_directory_path() / "benchmark.log" ).string();
+  measure( "append", filename );
+  measure( "uring", filename );
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* stl header */
+#include <array>
+#include <string>
+#include <string_view>
+
+/* modern.cpp.logger */
+#include <Escape.h>
+
+/* local header */
+#include "../shared/BenchmarkHelper.h"
+
+/**
+ * @brief Number of calls per measurement.
+ */
+constexpr std::size_t iterations = 1000000;
+
+/**
+ * @brief Short messages without special characters.
+ */
+constexpr std::array<std::string_view, 4> shortMessages = {
+  "Connection established",
+  "user=4711 latency=83us",
+  "Cache miss for key session:9f2c",
+  "Worker 7 started"
+};
+
+/**
+ * @brief Long messages without special characters.
+ */
+constexpr std::array<std::string_view, 2> longMessages = {
+  "Request GET /api/v2/orders/1849302/items?expand=product,price completed with status 200 in 12.4ms, 3 queries, 18 KiB response, client 10.14.2.87",
+  "Configuration reloaded from /etc/service/config.yaml: 42 keys, 3 changed (pool_size=64, timeout=2500ms, retry=exponential), 0 rejected"
+};
+
+/**
+ * @brief Messages with special characters, e.g. conditions, templates and payloads.
+ */
+constexpr std::array<std::string_view, 4> specialMessages = {
+  "Queue depth 1200 > limit 1000, dropping oldest entries",
+  "Parsing std::vector<std::pair<int, std::string>> failed",
+  "Payload <order id=\"17\"><item sku=\"A-1\"/></order> rejected",
+  "Query a=1&b=2&c=3 took 5ms"
+};
+
+/**
+ * @brief Escape one character after the other.
+ * @param _output   Text is appended here.
+ * @param _text   Text to escape.
+ */
+static void naiveEscape( std::string &_output,
+                         std::string_view _text ) {
+
+  for ( const char character : _text ) {
+
+    switch ( character ) {
+
+      case '&':
+        _output.append( "&amp;" );
+        break;
+      case '<':
+        _output.append( "&lt;" );
+        break;
+      case '>':
+        _output.append( "&gt;" );
+        break;
+      default:
+        _output.push_back( character );
+        break;
+    }
+  }
+}
+
+/**
+ * @brief Measure both escapers with the messages.
+ * @param _name   Name of the messages.
+ * @param _messages   Messages, one per call.
+ */
+template <std::size_t Size>
+static void measure( std::string_view _name,
+                     const std::array<std::string_view, Size> &_messages ) {
+
+  std::string output {};
+  output.reserve( 512 );
+  std::size_t index = 0;
+
+  vx::BenchmarkHelper::print( std::string( _name ) + " (naive)", vx::BenchmarkHelper::nanosecondsPerCall( iterations, [ &output, &index, &_messages ] {
+    output.clear();
+    naiveEscape( output, _messages[ index++ % Size ] );
+  } ) );
+  vx::BenchmarkHelper::print( std::string( _name ) + " (vectorised)", vx::BenchmarkHelper::nanosecondsPerCall( iterations, [ &output, &index, &_messages ] {
+    output.clear();
+    vx::escape::appendXml( output, _messages[ index++ % Size ] );
+  } ) );
+}
+
+int main() {
+
+  measure( "Short plain", shortMessages );
+  measure( "Long plain", longMessages );
+  measure( "Special characters", specialMessages );
+  return EXIT_SUCCESS;
+}
@@ -33,7 +33,9 @@ option(CMAKE_VERBOSE_MAKEFILE "Show the complete build commands" OFF)
 
 # possibility to disable build steps
 option(LOGGER_BUILD_EXAMPLES "Build examples" ON)
+option(LOGGER_BUILD_BENCHMARKS "Build benchmarks" ON)
 option(LOGGER_BUILD_TESTS "Build tests" ON)
+option(LOGGER_BUILD_TOOLS "Build tools" ON)
 
 # for remove log severities
 # Possible values:
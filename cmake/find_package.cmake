@@ -32,3 +32,10 @@ if (UNIX)
   set(CMAKE_THREAD_LIBS_INIT "-lpthread")
 endif()
 find_package(Threads REQUIRED)
+
+# optional codecs of the compressed file logger
+find_package(ZLIB)
+find_path(LZ4_INCLUDE_DIR lz4frame.h)
+find_library(LZ4_LIBRARY lz4)
+find_path(ZSTD_INCLUDE_DIR zstd.h)
+find_library(ZSTD_LIBRARY zstd)
@@ -59,18 +59,14 @@ constexpr auto logMessage = "This is a log message";
  */
 static void work() {
 
-  std::ostringstream sstream;
-  sstream << logMessage;
-
-  const std::string message = sstream.str();
   for ( std::size_t i  = 0; i < logMessageCount; ++i ) {
 
-    vx::LogFatal( message );
-    vx::LogError( message );
-    vx::LogWarning( message );
-    vx::LogInfo( message );
-    vx::LogDebug( message );
-    vx::LogVerbose( message );
+    vx::LogFatal( "{} #{}", logMessage, i );
+    vx::LogError( "{} #{}", logMessage, i );
+    vx::LogWarning( "{} #{}", logMessage, i );
+    vx::LogInfo( "{} #{}", logMessage, i );
+    vx::LogDebug( "{} #{}", logMessage, i );
+    vx::LogVerbose( "{} #{}", logMessage, i );
   }
 }
 
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* stl header */
+#include <array>
+#include <iostream>
+#include <utility>
+
+/* local header */
+#include "AppendFileWriter.h"
+
+namespace vx {
+
+  AppendFileWriter::AppendFileWriter( FileWriterSettings _settings ) noexcept
+      : DescriptorFileWriter( std::move( _settings ) ) {}
+
+  AppendFileWriter::~AppendFileWriter() noexcept {
+
+    flush();
+  }
+
+  void AppendFileWriter::write( std::string_view _text,
+                                Severity _severity ) noexcept {
+
+    try {
+
+      /* only flush takes the lock of another thread */
+      AppendBuffer &buffer = m_buffers.local();
+      const std::lock_guard<std::mutex> lock( buffer.mutex );
+
+      const auto now = std::chrono::steady_clock::now();
+      if ( buffer.data.empty() ) {
+
+        buffer.pendingSince = now;
+      }
+      const std::size_t bufferSize = settings().bufferSize;
+      if ( _severity >= settings().flushSeverity || buffer.data.size() + _text.size() >= bufferSize || now - buffer.pendingSince >= settings().flushInterval ) {
+
+        const std::array<std::string_view, 2> parts = { buffer.data, _text };
+        writeDescriptor( parts );
+        buffer.data.clear();
+        return;
+      }
+
+      if ( buffer.data.capacity() < bufferSize ) {
+
+        buffer.data.reserve( bufferSize );
+      }
+      buffer.data.append( _text );
+    }
+    catch ( const std::exception &_exception ) {
+
+      /* nothing to do, no buffer for this thread */
+      std::cout << _exception.what() << std::endl;
+    }
+  }
+
+  void AppendFileWriter::flush() noexcept {
+
+    m_buffers.forEach( [ this ]( auto &_entry ) {
+      const std::lock_guard<std::mutex> lock( _entry.value.mutex );
+      const std::array<std::string_view, 1> parts = { _entry.value.data };
+      writeDescriptor( parts );
+      _entry.value.data.clear();
+    } );
+    /* buffers of exited threads are written now */
+    m_buffers.collect( []( const AppendBuffer &_buffer ) { return _buffer.data.empty(); } );
+  }
+
+  void AppendFileWriter::flushExpired( std::chrono::steady_clock::time_point _now ) noexcept {
+
+    /* the buffer of an exited thread gets no next record, it is written at once */
+    m_buffers.forEach( [ this, _now ]( auto &_entry ) {
+      const std::lock_guard<std::mutex> lock( _entry.value.mutex );
+      if ( _entry.value.data.empty() || ( _now - _entry.value.pendingSince < settings().flushInterval && !_entry.retired.load( std::memory_order_acquire ) ) ) {
+
+        return;
+      }
+      const std::array<std::string_view, 1> parts = { _entry.value.data };
+      writeDescriptor( parts );
+      _entry.value.data.clear();
+    } );
+    m_buffers.collect( []( const AppendBuffer &_buffer ) { return _buffer.data.empty(); } );
+  }
+}
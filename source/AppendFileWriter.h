@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+/* stl header */
+#include <chrono>
+#include <mutex>
+#include <string>
+
+/* local header */
+#include "DescriptorFileWriter.h"
+#include "ThreadRegistry.h"
+
+/**
+ * @brief vx (VX APPS) namespace.
+ */
+namespace vx {
+
+  /**
+   * @brief The AppendFileWriter class - every thread collects its records in an own buffer and writes it
+   * with one writev (mode append), so threads do not wait for each other and lines never interleave.
+   * The records of one thread keep their order, records of different threads are ordered by the time their buffer
+   * is written. The buffer of an exited thread is written by the next flushExpired.
+   * @author Florian Becker <fb\@vxapps.com> (VX APPS)
+   */
+  class AppendFileWriter : public DescriptorFileWriter {
+
+  public:
+    /**
+     * @brief Constructor for AppendFileWriter.
+     * @param _settings   Flush policy.
+     */
+    explicit AppendFileWriter( FileWriterSettings _settings ) noexcept;
+
+    /**
+     * @brief Destructor for AppendFileWriter - writes the buffers of all threads.
+     */
+    ~AppendFileWriter() noexcept override;
+
+    /**
+     * @brief Buffer the text of the calling thread and write it, as configured.
+     * @param _text   Text to write.
+     * @param _severity   Severity level of the text.
+     */
+    void write( std::string_view _text,
+                Severity _severity ) noexcept override;
+
+    /**
+     * @brief Write the buffers of all threads.
+     */
+    void flush() noexcept override;
+
+    /**
+     * @brief Write the buffers, whose oldest record is older than the flush interval.
+     * @param _now   Current time.
+     */
+    void flushExpired( std::chrono::steady_clock::time_point _now ) noexcept override;
+
+  private:
+    /**
+     * @brief The AppendBuffer struct - pending records of one thread.
+     */
+    struct AppendBuffer {
+
+      /**
+       * @brief Only contended, while flush writes the buffers of all threads.
+       */
+      std::mutex mutex {};
+
+      /**
+       * @brief Complete lines, not yet written.
+       */
+      std::string data {};
+
+      /**
+       * @brief Time of the oldest pending record.
+       */
+      std::chrono::steady_clock::time_point pendingSince {};
+    };
+
+    /**
+     * @brief Buffers of all threads.
+     */
+    ThreadRegistry<AppendBuffer> m_buffers {};
+  };
+}
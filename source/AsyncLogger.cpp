@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* system header */
+#if defined __x86_64__ || defined __i386__
+  #include <x86intrin.h>
+#elif defined _M_X64 || defined _M_IX86
+  #include <intrin.h>
+#endif
+
+/* stl header */
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+/* local header */
+#include "AsyncLogger.h"
+#include "LoggerFactory.h"
+
+namespace vx {
+
+  /**
+   * @brief Default capacity of the queue.
+   */
+  constexpr std::size_t queueCapacity = 8192;
+
+  /**
+   * @brief Default wake-up interval of the backend in milliseconds.
+   */
+  constexpr int wakeupInterval = 10;
+
+  /**
+   * @brief Raw clock tick, only used to order the records of different threads.
+   * The time stamp counter is much cheaper than a wall clock, that might even be a syscall.
+   * @return Monotonic tick.
+   */
+  static std::uint64_t captureTick() noexcept {
+
+#if defined __x86_64__ || defined __i386__ || defined _M_X64 || defined _M_IX86
+    return __rdtsc();
+#else
+    return static_cast<std::uint64_t>( std::chrono::steady_clock::now().time_since_epoch().count() );
+#endif
+  }
+
+  AsyncLogger::AsyncLogger( const std::unordered_map<std::string, std::string> &_configuration )
+    : Logger( _configuration ) {
+
+    /* the sink is configured by the same configuration, except of the type */
+    std::unordered_map<std::string, std::string> sinkConfiguration( _configuration );
+    const auto sink = _configuration.find( "sink" );
+    sinkConfiguration[ "type" ] = sink != _configuration.end() ? sink->second : "std";
+    if ( sinkConfiguration[ "type" ] == "async" ) {
+
+      throw std::invalid_argument( "Async logger cannot use an async logger as sink." );
+    }
+    m_sink = LoggerFactory::instance().produce( sinkConfiguration );
+
+    m_capacity = configuredValue( _configuration, "queue_capacity", queueCapacity );
+    const auto queue = _configuration.find( "queue" );
+    if ( queue != _configuration.end() && queue->second != "shared" && queue->second != "thread" ) {
+
+      throw std::invalid_argument( queue->second + " is not a valid queue, use shared or thread." );
+    }
+    m_perThread = queue != _configuration.end() && queue->second == "thread";
+    if ( !m_perThread ) {
+
+      m_queue = std::make_unique<RingBuffer<Record>>( m_capacity );
+    }
+    /* the backend never sees a generation of zero, so the first merge takes a snapshot */
+    m_mergeGeneration = std::numeric_limits<std::uint64_t>::max();
+    m_wakeupInterval = std::chrono::milliseconds( configuredValue( _configuration, "wakeup_interval", wakeupInterval ) );
+
+    m_backend = std::thread( &AsyncLogger::run, this );
+  }
+
+  AsyncLogger::~AsyncLogger() noexcept {
+
+    m_stop.store( true, std::memory_order_release );
+    m_condition.notify_one();
+    if ( m_backend.joinable() ) {
+
+      m_backend.join();
+    }
+  }
+
+  void AsyncLogger::log( std::string_view _message,
+                         Severity _severity,
+                         const CallSite &_location ) noexcept {
+
+    if ( !accepts( _severity ) ) {
+
+      return;
+    }
+
+    enqueue( { std::string( _message ), _severity, m_callSites.intern( _location, {}, _severity ).location.site(), false, captureTick(), {}, std::chrono::system_clock::now(), std::this_thread::get_id() } );
+  }
+
+  void AsyncLogger::log( std::string_view _message ) noexcept {
+
+    enqueue( { std::string( _message ), Severity::Info, CallSiteRegistry::unknownSite, true, captureTick(), {}, std::chrono::system_clock::now(), std::this_thread::get_id() } );
+  }
+
+  void AsyncLogger::log( const LogRecord &_record ) noexcept {
+
+    const std::uint32_t site = _record.location ? m_callSites.intern( *_record.location, {}, _record.severity ).location.site() : CallSiteRegistry::unknownSite;
+    enqueue( { std::string( _record.message ), _record.severity, site, false, captureTick(), _record.deferred ? *_record.deferred : DeferredMessage {}, _record.time, _record.thread } );
+  }
+
+  void AsyncLogger::logDeferred( const DeferredMessage &_message,
+                                 Severity _severity,
+                                 const CallSite &_location ) noexcept {
+
+    if ( !accepts( _severity ) ) {
+
+      return;
+    }
+
+    enqueue( { {}, _severity, m_callSites.intern( _location, {}, _severity ).location.site(), false, captureTick(), _message, std::chrono::system_clock::now(), std::this_thread::get_id() } );
+  }
+
+  void AsyncLogger::setSeverity( Severity _severity ) noexcept {
+
+    Logger::setSeverity( _severity );
+    m_sink->setSeverity( _severity );
+  }
+
+  void AsyncLogger::flush() noexcept {
+
+    std::unique_lock<std::mutex> lock( m_mutex );
+    const std::uint64_t ticket = m_flushRequested.fetch_add( 1, std::memory_order_acq_rel ) + 1;
+    m_condition.notify_one();
+    m_flushedCondition.wait( lock, [ this, ticket ] { return m_flushed >= ticket; } );
+  }
+
+  void AsyncLogger::enqueue( Record &&_record ) noexcept {
+
+    if ( m_perThread ) {
+
+      try {
+
+        auto &queue = m_threadQueues.local( m_capacity );
+        while ( !queue.push( std::move( _record ) ) ) {
+
+          /* queue is full, wake up the backend and give it some time */
+          m_full.store( true, std::memory_order_release );
+          m_condition.notify_one();
+          std::this_thread::yield();
+        }
+      }
+      catch ( const std::exception &_exception ) {
+
+        /* nothing to do, no queue for this thread, the record is dropped */
+        std::cout << _exception.what() << std::endl;
+      }
+      return;
+    }
+
+    while ( !m_queue->push( std::move( _record ) ) ) {
+
+      /* queue is full, wake up the backend and give it some time */
+      m_full.store( true, std::memory_order_release );
+      m_condition.notify_one();
+      std::this_thread::yield();
+    }
+  }
+
+  void AsyncLogger::run() noexcept {
+
+    /* the sink is flushed on request and once the producers are idle, so it can coalesce writes under load */
+    bool unflushed = false;
+    while ( !m_stop.load( std::memory_order_acquire ) ) {
+
+      /* records enqueued before a flush request are visible to the drain */
+      const std::uint64_t requested = m_flushRequested.load( std::memory_order_acquire );
+      m_full.store( false, std::memory_order_relaxed );
+      const bool written = drain();
+      unflushed = unflushed || written;
+      if ( requested != m_flushed ) {
+
+        m_sink->flush();
+        unflushed = false;
+        {
+          const std::lock_guard<std::mutex> lock( m_mutex );
+          m_flushed = requested;
+        }
+        m_flushedCondition.notify_all();
+      }
+      else if ( unflushed && !written ) {
+
+        m_sink->flush();
+        unflushed = false;
+      }
+
+      std::unique_lock<std::mutex> lock( m_mutex );
+      m_condition.wait_for( lock, m_wakeupInterval, [ this ] { return m_stop.load( std::memory_order_acquire ) || m_flushRequested.load( std::memory_order_acquire ) != m_flushed || m_full.load( std::memory_order_acquire ) || ( m_queue && !m_queue->empty() ); } );
+    }
+    drain();
+    m_sink->flush();
+    {
+      const std::lock_guard<std::mutex> lock( m_mutex );
+      m_flushed = m_flushRequested.load( std::memory_order_acquire );
+    }
+    m_flushedCondition.notify_all();
+  }
+
+  bool AsyncLogger::drain() noexcept {
+
+    if ( m_perThread ) {
+
+      return merge();
+    }
+
+    bool written = false;
+    while ( auto record = m_queue->pop() ) {
+
+      write( *record );
+      written = true;
+    }
+    return written;
+  }
+
+  bool AsyncLogger::merge() noexcept {
+
+    /* refresh the snapshot, if a thread registered or an exited one was dropped */
+    if ( const std::uint64_t generation = m_threadQueues.generation(); generation != m_mergeGeneration ) {
+
+      m_mergeGeneration = generation;
+      m_mergeQueues.clear();
+      m_threadQueues.forEach( [ this ]( auto &_entry ) { m_mergeQueues.push_back( &_entry.value ); } );
+    }
+
+    /* k-way merge, always write the oldest front record of all queues */
+    bool written = false;
+    while ( true ) {
+
+      SingleProducerRingBuffer<Record> *oldest = nullptr;
+      const Record *oldestRecord = nullptr;
+      for ( auto *queue : m_mergeQueues ) {
+
+        const Record *record = queue->front();
+        if ( record && ( !oldestRecord || record->timestamp < oldestRecord->timestamp ) ) {
+
+          oldest = queue;
+          oldestRecord = record;
+        }
+      }
+      if ( !oldest ) {
+
+        break;
+      }
+      write( *oldestRecord );
+      oldest->pop();
+      written = true;
+    }
+
+    /* exited threads leave their queue behind, drop them once they are empty */
+    m_threadQueues.collect( []( auto &_queue ) { return _queue.empty(); } );
+    return written;
+  }
+
+  void AsyncLogger::write( const Record &_record ) noexcept {
+
+    if ( _record.raw ) {
+
+      m_sink->log( _record.message );
+      return;
+    }
+
+    /* the sink renders the message, or keeps the raw arguments, with the time and thread of the producer */
+    const CallSite &location = m_callSites.site( _record.site ).location;
+    m_sink->log( LogRecord { _record.severity, _record.time, &location, _record.message, _record.deferred.empty() ? nullptr : &_record.deferred, _record.thread } );
+  }
+}
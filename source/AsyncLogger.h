@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+/* stl header */
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/* local header */
+#include "CallSiteRegistry.h"
+#include "Logger.h"
+#include "RingBuffer.h"
+#include "ThreadRegistry.h"
+
+/**
+ * @brief vx (VX APPS) namespace.
+ */
+namespace vx {
+
+  /**
+   * @brief The AsyncLogger class for handing messages to a background writer thread.
+   * Wraps one of the other logger types (std, file, xml, json), configured as sink.
+   * With queue=thread every producing thread gets its own queue and the backend
+   * merges them by capture time.
+   * @author Florian Becker <fb\@vxapps.com> (VX APPS)
+   */
+  class AsyncLogger : public Logger {
+
+  public:
+    /**
+     * @brief Deletet default constructor for AsyncLogger.
+     */
+    AsyncLogger() = delete;
+
+    /**
+     * @brief Default constructor for AsyncLogger.
+     * @param _configuration   Logger configuration.
+     */
+    explicit AsyncLogger( const std::unordered_map<std::string, std::string> &_configuration ) noexcept( false );
+
+    /**
+     * @brief Deleted copy constructor.
+     */
+    AsyncLogger( const AsyncLogger & ) = delete;
+
+    /**
+     * @brief Deleted move constructor.
+     */
+    AsyncLogger( AsyncLogger && ) = delete;
+
+    /**
+     * @brief Default destructor for AsyncLogger - writes all pending messages.
+     */
+    ~AsyncLogger() noexcept override;
+
+    /**
+     * @brief Deleted copy assign operator.
+     */
+    AsyncLogger &operator=( const AsyncLogger & ) = delete;
+
+    /**
+     * @brief Deleted move assign operator.
+     */
+    AsyncLogger &operator=( AsyncLogger && ) = delete;
+
+    /**
+     * @brief Enqueue the log message.
+     * @param _message   Message to log.
+     * @param _severity   Severity level of the message.
+     * @param _location   Source location information.
+     */
+    void log( std::string_view _message,
+              Severity _severity,
+              const CallSite &_location = std::source_location::current() ) noexcept override;
+
+    /**
+     * @brief Enqueue the already built log message.
+     * @param _message   Message to log.
+     */
+    void log( std::string_view _message ) noexcept override;
+
+    /**
+     * @brief Enqueue the captured arguments, the message is rendered by the backend.
+     * @param _message   Format string and captured arguments.
+     * @param _severity   Severity level of the message.
+     * @param _location   Source location information.
+     */
+    void logDeferred( const DeferredMessage &_message,
+                      Severity _severity,
+                      const CallSite &_location ) noexcept override;
+
+    /**
+     * @brief Enqueue a copy of the record, the backend hands it to the sink.
+     * @param _record   Record to log.
+     */
+    void log( const LogRecord &_record ) noexcept override;
+
+    /**
+     * @brief Change the runtime severity threshold of this logger and the sink.
+     * @param _severity   Lowest severity to log, never below avoidLogBelow.
+     */
+    void setSeverity( Severity _severity ) noexcept override;
+
+    /**
+     * @brief Wait until the backend wrote all messages enqueued before and flushed the sink.
+     */
+    void flush() noexcept override;
+
+  private:
+    /**
+     * @brief The Record struct - one queued message.
+     */
+    struct Record {
+
+      /**
+       * @brief Message to log.
+       */
+      std::string message {};
+
+      /**
+       * @brief Severity level of the message.
+       */
+      Severity severity = Severity::Info;
+
+      /**
+       * @brief Id of the call site in the CallSiteRegistry.
+       */
+      std::uint32_t site = CallSiteRegistry::unknownSite;
+
+      /**
+       * @brief Message is already built and is passed through.
+       */
+      bool raw = false;
+
+      /**
+       * @brief Raw capture tick, to merge per-thread queues in order.
+       */
+      std::uint64_t timestamp = 0;
+
+      /**
+       * @brief Captured arguments, rendered by the backend instead of message.
+       */
+      DeferredMessage deferred {};
+
+      /**
+       * @brief Time, when the record was logged.
+       */
+      std::chrono::system_clock::time_point time {};
+
+      /**
+       * @brief Thread, that logged the record.
+       */
+      std::thread::id thread {};
+    };
+
+    /**
+     * @brief Enqueue a record, wait for the backend if the queue is full.
+     * The record is dropped, if the queue of a new thread cannot be allocated.
+     * @param _record   Record to enqueue.
+     */
+    void enqueue( Record &&_record ) noexcept;
+
+    /**
+     * @brief Backend thread, drains the queue into the sink.
+     */
+    void run() noexcept;
+
+    /**
+     * @brief Write all queued records to the sink.
+     * @return True, if a record was written.
+     */
+    bool drain() noexcept;
+
+    /**
+     * @brief Write all records of the per-thread queues, ordered by capture time.
+     * @return True, if a record was written.
+     */
+    bool merge() noexcept;
+
+    /**
+     * @brief Pass one record to the sink.
+     * @param _record   Record to write.
+     */
+    void write( const Record &_record ) noexcept;
+
+    /**
+     * @brief Registry of the call sites, created before this logger, so it outlives the backend.
+     */
+    CallSiteRegistry &m_callSites = CallSiteRegistry::instance();
+
+    /**
+     * @brief Logger, that is doing the formatting and writing.
+     */
+    std::unique_ptr<Logger> m_sink {};
+
+    /**
+     * @brief Queue between producers and backend.
+     */
+    std::unique_ptr<RingBuffer<Record>> m_queue {};
+
+    /**
+     * @brief Use a queue per producing thread.
+     */
+    bool m_perThread = false;
+
+    /**
+     * @brief Capacity of every queue.
+     */
+    std::size_t m_capacity = 0;
+
+    /**
+     * @brief Queues per producing thread.
+     */
+    ThreadRegistry<SingleProducerRingBuffer<Record>> m_threadQueues {};
+
+    /**
+     * @brief Backend snapshot of the per-thread queues.
+     */
+    std::vector<SingleProducerRingBuffer<Record> *> m_mergeQueues {};
+
+    /**
+     * @brief Generation of the snapshot.
+     */
+    std::uint64_t m_mergeGeneration = 0;
+
+    /**
+     * @brief Interval for waking up the backend.
+     */
+    std::chrono::milliseconds m_wakeupInterval {};
+
+    /**
+     * @brief A producer found its queue full, set by both queue kinds, so the backend does not wait for the wake-up interval.
+     */
+    std::atomic<bool> m_full { false };
+
+    /**
+     * @brief Backend is asked to stop.
+     */
+    std::atomic<bool> m_stop { false };
+
+    /**
+     * @brief Mutex for waking up the backend.
+     */
+    std::mutex m_mutex {};
+
+    /**
+     * @brief Condition for waking up the backend.
+     */
+    std::condition_variable m_condition {};
+
+    /**
+     * @brief Number of requested flushes.
+     */
+    std::atomic<std::uint64_t> m_flushRequested { 0 };
+
+    /**
+     * @brief Number of done flushes, guarded by m_mutex.
+     */
+    std::uint64_t m_flushed = 0;
+
+    /**
+     * @brief Condition for waiting on a flush.
+     */
+    std::condition_variable m_flushedCondition {};
+
+    /**
+     * @brief Backend thread.
+     */
+    std::thread m_backend {};
+  };
+}
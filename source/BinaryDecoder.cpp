@@ -0,0 +1,461 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* stl header */
+#include <array>
+#include <bit>
+#include <cstring>
+
+/* local header */
+#include "BinaryDecoder.h"
+#include "BinaryFormat.h"
+#include "Format.h"
+#include "SeverityLabel.h"
+#include "TimestampCache.h"
+
+namespace vx {
+
+  /**
+   * @brief Format one argument with the format specification of its replacement field.
+   * @param _field   Replacement field without argument id, e.g. "{:.2f}".
+   * @param _argument   Raw bytes of the argument.
+   * @param _output   Text is appended here.
+   */
+  template<typename Argument>
+  static void renderArgument( const std::string &_field,
+                              const char *_argument,
+                              std::string &_output ) {
+
+    formatTo( _output, _field, makeFormatArguments( binary::loadArgument<Argument>( _argument ) ) );
+  }
+
+  /**
+   * @brief Format one argument of the given type.
+   * @param _type   Argument type.
+   * @param _field   Replacement field without argument id.
+   * @param _argument   Raw bytes of the argument.
+   * @param _output   Text is appended here.
+   */
+  static void renderArgument( ArgumentType _type,
+                              const std::string &_field,
+                              const char *_argument,
+                              std::string &_output ) {
+
+    switch ( _type ) {
+
+      case ArgumentType::Bool:
+        renderArgument<bool>( _field, _argument, _output );
+        break;
+      case ArgumentType::Char:
+        renderArgument<char>( _field, _argument, _output );
+        break;
+      case ArgumentType::Int8:
+        renderArgument<std::int8_t>( _field, _argument, _output );
+        break;
+      case ArgumentType::Int16:
+        renderArgument<std::int16_t>( _field, _argument, _output );
+        break;
+      case ArgumentType::Int32:
+        renderArgument<std::int32_t>( _field, _argument, _output );
+        break;
+      case ArgumentType::Int64:
+        renderArgument<std::int64_t>( _field, _argument, _output );
+        break;
+      case ArgumentType::UInt8:
+        renderArgument<std::uint8_t>( _field, _argument, _output );
+        break;
+      case ArgumentType::UInt16:
+        renderArgument<std::uint16_t>( _field, _argument, _output );
+        break;
+      case ArgumentType::UInt32:
+        renderArgument<std::uint32_t>( _field, _argument, _output );
+        break;
+      case ArgumentType::UInt64:
+        renderArgument<std::uint64_t>( _field, _argument, _output );
+        break;
+      case ArgumentType::Float:
+        renderArgument<float>( _field, _argument, _output );
+        break;
+      case ArgumentType::Double:
+        renderArgument<double>( _field, _argument, _output );
+        break;
+      case ArgumentType::Other:
+        break;
+    }
+  }
+
+  /**
+   * @brief Store a decoded integer with the size of its type.
+   * @param _type   Argument type.
+   * @param _value   Decoded value.
+   * @param _argument   Raw bytes of the argument.
+   */
+  template<typename Value>
+  static void storeArgument( ArgumentType _type,
+                             Value _value,
+                             char *_argument ) noexcept {
+
+    const auto store = [ _argument ]( auto _typed ) { std::memcpy( _argument, &_typed, sizeof( _typed ) ); };
+    switch ( _type ) {
+
+      case ArgumentType::Int8:
+        store( static_cast<std::int8_t>( _value ) );
+        break;
+      case ArgumentType::Int16:
+        store( static_cast<std::int16_t>( _value ) );
+        break;
+      case ArgumentType::Int32:
+        store( static_cast<std::int32_t>( _value ) );
+        break;
+      case ArgumentType::UInt16:
+        store( static_cast<std::uint16_t>( _value ) );
+        break;
+      case ArgumentType::UInt32:
+        store( static_cast<std::uint32_t>( _value ) );
+        break;
+      default:
+        store( _value );
+        break;
+    }
+  }
+
+  bool BinaryDecoder::decode( std::string_view _data,
+                              std::string &_output ) {
+
+    m_data = _data;
+    m_offset = 0;
+    while ( m_offset < m_data.size() ) {
+
+      std::uint8_t frame = 0;
+      static_cast<void>( readByte( frame ) );
+      switch ( static_cast<binary::Frame>( frame ) ) {
+
+        case binary::Frame::Header:
+          if ( !decodeHeader() ) {
+
+            return false;
+          }
+          break;
+        case binary::Frame::Site:
+          if ( !decodeSite() ) {
+
+            return false;
+          }
+          break;
+        case binary::Frame::Text: {
+
+          const std::size_t start = _output.size();
+          std::string_view message {};
+          if ( !decodeRecord( _output ) || !readText( message ) ) {
+
+            _output.resize( start );
+            return false;
+          }
+          _output.append( message );
+          _output.push_back( '\n' );
+          break;
+        }
+        case binary::Frame::Deferred: {
+
+          const std::size_t start = _output.size();
+          const Site *site = decodeRecord( _output );
+          if ( !site || !decodeArguments( site->format, _output ) ) {
+
+            _output.resize( start );
+            return false;
+          }
+          _output.push_back( '\n' );
+          break;
+        }
+        case binary::Frame::Raw: {
+
+          std::string_view message {};
+          if ( !readText( message ) ) {
+
+            return false;
+          }
+          _output.append( message );
+          break;
+        }
+        default:
+          return false;
+      }
+    }
+    return true;
+  }
+
+  bool BinaryDecoder::readByte( std::uint8_t &_value ) noexcept {
+
+    if ( m_offset >= m_data.size() ) {
+
+      return false;
+    }
+    _value = static_cast<std::uint8_t>( m_data[ m_offset++ ] );
+    return true;
+  }
+
+  bool BinaryDecoder::readVarint( std::uint64_t &_value ) noexcept {
+
+    _value = 0;
+    for ( unsigned int shift = 0; shift < 64; shift += 7 ) {
+
+      std::uint8_t byte = 0;
+      if ( !readByte( byte ) ) {
+
+        return false;
+      }
+      _value |= static_cast<std::uint64_t>( byte & 0x7FU ) << shift;
+      if ( ( byte & 0x80U ) == 0 ) {
+
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool BinaryDecoder::readText( std::string_view &_value ) noexcept {
+
+    std::uint64_t size = 0;
+    return readVarint( size ) && readBytes( static_cast<std::size_t>( size ), _value );
+  }
+
+  bool BinaryDecoder::readBytes( std::size_t _size,
+                                 std::string_view &_value ) noexcept {
+
+    if ( _size > m_data.size() - m_offset ) {
+
+      return false;
+    }
+    _value = m_data.substr( m_offset, _size );
+    m_offset += _size;
+    return true;
+  }
+
+  bool BinaryDecoder::readArgument( ArgumentType _type,
+                                    char *_argument ) noexcept {
+
+    std::uint64_t value = 0;
+    std::string_view bytes {};
+    switch ( _type ) {
+
+      case ArgumentType::Int8:
+      case ArgumentType::Int16:
+      case ArgumentType::Int32:
+      case ArgumentType::Int64:
+        if ( !readVarint( value ) ) {
+
+          return false;
+        }
+        storeArgument( _type, binary::unzigzag( value ), _argument );
+        return true;
+      case ArgumentType::UInt16:
+      case ArgumentType::UInt32:
+      case ArgumentType::UInt64:
+        if ( !readVarint( value ) ) {
+
+          return false;
+        }
+        storeArgument( _type, value, _argument );
+        return true;
+      case ArgumentType::Bool:
+      case ArgumentType::Char:
+      case ArgumentType::UInt8:
+      case ArgumentType::Float:
+      case ArgumentType::Double:
+        if ( !readBytes( argumentSize( _type ), bytes ) ) {
+
+          return false;
+        }
+        std::memcpy( _argument, bytes.data(), bytes.size() );
+        return true;
+      case ArgumentType::Other:
+        break;
+    }
+    return false;
+  }
+
+  bool BinaryDecoder::decodeHeader() {
+
+    std::string_view magic {};
+    std::uint8_t version = 0;
+    std::uint8_t precision = 0;
+    std::uint8_t endian = 0;
+    if ( !readBytes( binary::magic.size(), magic ) || magic != binary::magic || !readByte( version ) || version != binary::version || !readByte( precision ) || precision > static_cast<std::uint8_t>( timestamp::Precision::NanoSeconds ) || !readByte( endian ) ) {
+
+      return false;
+    }
+
+    /* the raw arguments are only readable with the same byte order */
+    if ( ( endian == binary::littleEndian ) != ( std::endian::native == std::endian::little ) ) {
+
+      return false;
+    }
+
+    m_precision = static_cast<timestamp::Precision>( precision );
+    m_lastTicks = 0;
+    m_sites.clear();
+    return true;
+  }
+
+  bool BinaryDecoder::decodeSite() {
+
+    std::uint64_t id = 0;
+    std::uint8_t severity = 0;
+    std::uint64_t line = 0;
+    std::uint8_t supported = 0;
+    std::string_view file {};
+    std::string_view function {};
+    std::string_view format {};
+    if ( !readVarint( id ) || !readByte( severity ) || severity > static_cast<std::uint8_t>( Severity::Fatal ) || !readVarint( line ) || !readByte( supported ) || !readText( file ) || !readText( function ) || !readText( format ) ) {
+
+      return false;
+    }
+
+    m_sites[ id ] = { static_cast<Severity>( severity ), std::to_string( line ), supported != 0, std::string( file ), std::string( function ), std::string( format ) };
+    return true;
+  }
+
+  const BinaryDecoder::Site *BinaryDecoder::decodeRecord( std::string &_output ) {
+
+    std::uint64_t id = 0;
+    std::uint64_t delta = 0;
+    if ( !readVarint( id ) || !readVarint( delta ) ) {
+
+      return nullptr;
+    }
+    const auto site = m_sites.find( id );
+    if ( site == m_sites.end() ) {
+
+      return nullptr;
+    }
+
+    /* same layout as the FileLogger */
+    m_lastTicks += binary::unzigzag( delta );
+    TimestampCache::local().append( _output, m_precision, binary::fromTicks( m_lastTicks, m_precision ) );
+    _output.append( severityLabel( site->second.severity, false ) );
+    if ( site->second.supported ) {
+
+      _output.append( site->second.file );
+      _output.push_back( ':' );
+      _output.append( site->second.line );
+      _output.push_back( ' ' );
+      _output.append( site->second.function );
+      _output.push_back( ' ' );
+    }
+    return &site->second;
+  }
+
+  bool BinaryDecoder::decodeArguments( std::string_view _format,
+                                       std::string &_output ) {
+
+    std::uint8_t count = 0;
+    std::string_view types {};
+    if ( !readByte( count ) || !readBytes( count, types ) ) {
+
+      return false;
+    }
+    std::array<std::array<char, sizeof( std::uint64_t )>, DeferredMessage::argumentCapacity> arguments {};
+    for ( std::size_t i = 0; i < count; ++i ) {
+
+      if ( i >= arguments.size() || !readArgument( static_cast<ArgumentType>( types[ i ] ), arguments[ i ].data() ) ) {
+
+        return false;
+      }
+    }
+
+    /* replace every field with its argument, a field the arguments do not match leaves the format string as it is */
+    const std::size_t start = _output.size();
+    std::size_t next = 0;
+    std::string field {};
+    for ( std::size_t i = 0; i < _format.size(); ++i ) {
+
+      const char character = _format[ i ];
+      if ( ( character == '{' || character == '}' ) && i + 1 < _format.size() && _format[ i + 1 ] == character ) {
+
+        _output.push_back( character );
+        ++i;
+        continue;
+      }
+      if ( character == '}' ) {
+
+        _output.resize( start );
+        _output.append( _format );
+        return true;
+      }
+      if ( character != '{' ) {
+
+        _output.push_back( character );
+        continue;
+      }
+
+      const std::size_t end = _format.find_first_of( "{}", i + 1 );
+      if ( end == std::string_view::npos || _format[ end ] == '{' ) {
+
+        _output.resize( start );
+        _output.append( _format );
+        return true;
+      }
+      const std::string_view replacement = _format.substr( i + 1, end - i - 1 );
+      const std::size_t colon = replacement.find( ':' );
+      const std::string_view id = replacement.substr( 0, colon );
+      std::size_t index = next++;
+      if ( !id.empty() ) {
+
+        index = 0;
+        for ( const char digit : id ) {
+
+          if ( digit < '0' || digit > '9' ) {
+
+            index = count;
+            break;
+          }
+          index = index * 10 + static_cast<std::size_t>( digit - '0' );
+        }
+      }
+      if ( index >= count ) {
+
+        _output.resize( start );
+        _output.append( _format );
+        return true;
+      }
+
+      field.clear();
+      field.push_back( '{' );
+      if ( colon != std::string_view::npos ) {
+
+        field.append( replacement.substr( colon ) );
+      }
+      field.push_back( '}' );
+      renderArgument( static_cast<ArgumentType>( types[ index ] ), field, arguments[ index ].data(), _output );
+      i = end;
+    }
+    return true;
+  }
+}
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+/* stl header */
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/* modern.cpp.core */
+#include <Timestamp.h>
+
+/* local header */
+#include "DeferredMessage.h"
+#include "Logger.h"
+
+/**
+ * @brief vx (VX APPS) namespace.
+ */
+namespace vx {
+
+  /**
+   * @brief The BinaryDecoder class - turns the frames of the BinaryFileLogger back into the text of the FileLogger.
+   * Timestamps are rendered in the local time zone, set TZ to the one of the writing host.
+   * @author Florian Becker <fb\@vxapps.com> (VX APPS)
+   */
+  class BinaryDecoder {
+
+  public:
+    /**
+     * @brief Decode frames and append the text.
+     * The data may contain several segments, e.g. of loggers appending to the same file.
+     * @param _data   Frames to decode.
+     * @param _output   Text is appended here.
+     * @return True, if all frames were decoded. False on a truncated or corrupt frame, the text up to it is appended.
+     */
+    bool decode( std::string_view _data,
+                 std::string &_output );
+
+  private:
+    /**
+     * @brief The Site struct - call site of the records.
+     */
+    struct Site {
+
+      /**
+       * @brief Severity level of the call site.
+       */
+      Severity severity = Severity::Info;
+
+      /**
+       * @brief Rendered line number.
+       */
+      std::string line {};
+
+      /**
+       * @brief Compiler provided the source location.
+       */
+      bool supported = false;
+
+      /**
+       * @brief Full file name.
+       */
+      std::string file {};
+
+      /**
+       * @brief Function name.
+       */
+      std::string function {};
+
+      /**
+       * @brief Format string.
+       */
+      std::string format {};
+    };
+
+    /**
+     * @brief Read one byte.
+     * @param _value   The byte.
+     * @return True, if the byte was available.
+     */
+    bool readByte( std::uint8_t &_value ) noexcept;
+
+    /**
+     * @brief Read an unsigned varint.
+     * @param _value   The value.
+     * @return True, if the varint was complete.
+     */
+    bool readVarint( std::uint64_t &_value ) noexcept;
+
+    /**
+     * @brief Read a text with its length.
+     * @param _value   View on the text.
+     * @return True, if the text was complete.
+     */
+    bool readText( std::string_view &_value ) noexcept;
+
+    /**
+     * @brief Read a fixed number of bytes.
+     * @param _size   Number of bytes.
+     * @param _value   View on the bytes.
+     * @return True, if the bytes were available.
+     */
+    bool readBytes( std::size_t _size,
+                    std::string_view &_value ) noexcept;
+
+    /**
+     * @brief Read a captured argument.
+     * @param _type   Argument type.
+     * @param _argument   Raw bytes of the argument, as captured.
+     * @return True, if the argument was complete.
+     */
+    bool readArgument( ArgumentType _type,
+                       char *_argument ) noexcept;
+
+    /**
+     * @brief Decode a header frame.
+     * @return True, if the header is valid.
+     */
+    bool decodeHeader();
+
+    /**
+     * @brief Decode a site frame.
+     * @return True, if the site is valid.
+     */
+    bool decodeSite();
+
+    /**
+     * @brief Decode the common part of a record and append the prefix of the log line.
+     * @param _output   Text is appended here.
+     * @return Site of the record or nullptr, if the record is invalid.
+     */
+    const Site *decodeRecord( std::string &_output );
+
+    /**
+     * @brief Decode the raw arguments and render the format string.
+     * @param _format   Format string.
+     * @param _output   Text is appended here.
+     * @return True, if the arguments are valid.
+     */
+    bool decodeArguments( std::string_view _format,
+                          std::string &_output );
+
+    /**
+     * @brief Frames to decode.
+     */
+    std::string_view m_data {};
+
+    /**
+     * @brief Read position in the frames.
+     */
+    std::size_t m_offset = 0;
+
+    /**
+     * @brief Precision of the current segment.
+     */
+    timestamp::Precision m_precision = timestamp::Precision::MicroSeconds;
+
+    /**
+     * @brief Ticks of the last record.
+     */
+    std::int64_t m_lastTicks = 0;
+
+    /**
+     * @brief Call sites of the current segment.
+     */
+    std::unordered_map<std::uint64_t, Site> m_sites {};
+  };
+}
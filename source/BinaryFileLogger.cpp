@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* stl header */
+#include <bit>
+#include <iostream>
+
+/* local header */
+#include "BinaryFileLogger.h"
+
+namespace vx {
+
+  BinaryFileLogger::BinaryFileLogger( const std::unordered_map<std::string, std::string> &_configuration )
+      : FileLogger( _configuration, std::ofstream::out | std::ofstream::app | std::ofstream::binary ) {
+
+    /* a call site is defined once per file before its records, only one shared stream keeps that order */
+    ignoreMode( _configuration, "binary", "using mode stream" );
+
+    /* a rotated file has to start with the header, so the file is only replaced before a record */
+    setReplaceOnWrite( false );
+    beginFile();
+  }
+
+  void BinaryFileLogger::log( std::string_view _message ) noexcept {
+
+    const std::lock_guard<std::mutex> lock( m_mutex );
+    try {
+
+      if ( replaceFile() ) {
+
+        beginFile();
+      }
+      m_frame.clear();
+      m_frame.push_back( static_cast<char>( binary::Frame::Raw ) );
+      binary::appendText( m_frame, _message );
+      writeFrame( Severity::Verbose );
+    }
+    catch ( const std::exception &_exception ) {
+
+      std::cout << _exception.what() << std::endl;
+    }
+  }
+
+  void BinaryFileLogger::log( const LogRecord &_record ) noexcept {
+
+    /* types, the decoder cannot render, and records without a location are rendered here */
+    const DeferredMessage *deferred = _record.location ? _record.deferred : nullptr;
+    for ( std::size_t i = 0; deferred && i < deferred->argumentCount(); ++i ) {
+
+      if ( deferred->argumentTypes()[ i ] == ArgumentType::Other ) {
+
+        deferred = nullptr;
+      }
+    }
+
+    const CallSiteInfo &site = _record.location ? m_callSites.intern( *_record.location, deferred ? deferred->format() : std::string_view(), _record.severity ) : m_callSites.site( CallSiteRegistry::unknownSite );
+    const std::string_view message = deferred ? std::string_view() : Logger::message( _record );
+    const std::lock_guard<std::mutex> lock( m_mutex );
+    try {
+
+      if ( !deferred ) {
+
+        beginRecord( binary::Frame::Text, site, _record.timeOrNow() );
+        binary::appendText( m_frame, message );
+        writeFrame( _record.severity );
+        return;
+      }
+
+      beginRecord( binary::Frame::Deferred, site, _record.timeOrNow() );
+      m_frame.push_back( static_cast<char>( deferred->argumentCount() ) );
+      for ( std::size_t i = 0; i < deferred->argumentCount(); ++i ) {
+
+        m_frame.push_back( static_cast<char>( deferred->argumentTypes()[ i ] ) );
+      }
+      const char *argument = deferred->arguments().data();
+      for ( std::size_t i = 0; i < deferred->argumentCount(); ++i ) {
+
+        binary::appendArgument( m_frame, deferred->argumentTypes()[ i ], argument );
+        argument += argumentSize( deferred->argumentTypes()[ i ] );
+      }
+      writeFrame( _record.severity );
+    }
+    catch ( const std::exception &_exception ) {
+
+      std::cout << _exception.what() << std::endl;
+    }
+  }
+
+  void BinaryFileLogger::beginRecord( binary::Frame _frame,
+                                      const CallSiteInfo &_site,
+                                      std::chrono::system_clock::time_point _time ) {
+
+    if ( replaceFile() ) {
+
+      beginFile();
+    }
+    m_frame.clear();
+    const std::uint32_t id = _site.location.site();
+    if ( id >= m_written.size() ) {
+
+      m_written.resize( id + 1, false );
+    }
+    if ( !m_written[ id ] ) {
+
+      m_written[ id ] = true;
+      m_frame.push_back( static_cast<char>( binary::Frame::Site ) );
+      binary::appendVarint( m_frame, id );
+      m_frame.push_back( static_cast<char>( _site.severity ) );
+      binary::appendVarint( m_frame, _site.location.line() );
+      m_frame.push_back( static_cast<char>( _site.location.supported() ) );
+      binary::appendText( m_frame, _site.location.file_name() );
+      binary::appendText( m_frame, _site.location.function_name() );
+      binary::appendText( m_frame, _site.format );
+    }
+
+    const std::int64_t ticks = binary::toTicks( _time, precision() );
+    m_frame.push_back( static_cast<char>( _frame ) );
+    binary::appendVarint( m_frame, id );
+    binary::appendVarint( m_frame, binary::zigzag( ticks - m_lastTicks ) );
+    m_lastTicks = ticks;
+  }
+
+  void BinaryFileLogger::beginFile() noexcept {
+
+    /* every file starts a new segment, also when appending to an existing file */
+    m_frame.clear();
+    m_frame.push_back( static_cast<char>( binary::Frame::Header ) );
+    m_frame.append( binary::magic );
+    m_frame.push_back( static_cast<char>( binary::version ) );
+    m_frame.push_back( static_cast<char>( precision() ) );
+    m_frame.push_back( static_cast<char>( std::endian::native == std::endian::little ? binary::littleEndian : 0 ) );
+    writeFrame( Severity::Verbose );
+
+    /* the call sites and the timestamp delta start again */
+    m_written.assign( m_written.size(), false );
+    m_lastTicks = 0;
+  }
+
+  void BinaryFileLogger::writeFrame( Severity _severity ) noexcept {
+
+    write( m_frame, _severity );
+    m_frame.clear();
+  }
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+/* stl header */
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/* local header */
+#include "BinaryFormat.h"
+#include "CallSiteRegistry.h"
+#include "FileLogger.h"
+
+/**
+ * @brief vx (VX APPS) namespace.
+ */
+namespace vx {
+
+  /**
+   * @brief The BinaryFileLogger class for writing messages as compact binary frames to file.
+   * The static metadata of every call site is written once per file, the records only carry the
+   * id of the call site, the timestamp delta and the message or the raw arguments.
+   * The tool binary_decoder turns the file back into the text of the FileLogger.
+   * The frames are always written with mode stream, mode append, uring and group print a warning.
+   * @author Florian Becker <fb\@vxapps.com> (VX APPS)
+   */
+  class BinaryFileLogger : public FileLogger {
+
+  public:
+    /**
+     * @brief Deletet default constructor for BinaryFileLogger.
+     */
+    BinaryFileLogger() = delete;
+
+    /**
+     * @brief Default constructor for BinaryFileLogger.
+     * @param _configuration   Logger configuration.
+     */
+    explicit BinaryFileLogger( const std::unordered_map<std::string, std::string> &_configuration ) noexcept( false );
+
+    using Logger::log;
+
+    /**
+     * @brief Write the record, a deferred record keeps the raw arguments and the decoder renders the message.
+     * @param _record   Record to log.
+     */
+    void log( const LogRecord &_record ) noexcept override;
+
+    /**
+     * @brief Write the already built message.
+     * @param _message   Message to log.
+     */
+    void log( std::string_view _message ) noexcept override;
+
+  private:
+    /**
+     * @brief Write the header and forget the written call sites, the lock has to be held.
+     */
+    void beginFile() noexcept;
+
+    /**
+     * @brief Start a record frame, the lock has to be held.
+     * Writes the call site first, if it is not yet in the file.
+     * @param _frame   Kind of record.
+     * @param _site   Call site of the record.
+     * @param _time   Time of the record.
+     */
+    void beginRecord( binary::Frame _frame,
+                      const CallSiteInfo &_site,
+                      std::chrono::system_clock::time_point _time );
+
+    /**
+     * @brief Write the frame buffer, the lock has to be held.
+     * @param _severity   Severity level of the frame, for the flush policy.
+     */
+    void writeFrame( Severity _severity ) noexcept;
+
+    /**
+     * @brief Registry of the call sites.
+     */
+    CallSiteRegistry &m_callSites = CallSiteRegistry::instance();
+
+    /**
+     * @brief Call sites, that are already written.
+     */
+    std::vector<bool> m_written {};
+
+    /**
+     * @brief Ticks of the last record.
+     */
+    std::int64_t m_lastTicks = 0;
+
+    /**
+     * @brief Buffer for the frames.
+     */
+    std::string m_frame {};
+
+    /**
+     * @brief Mutex for the frame order.
+     */
+    std::mutex m_mutex {};
+  };
+}
@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+/* stl header */
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+/* modern.cpp.core */
+#include <Timestamp.h>
+
+/* local header */
+#include "DeferredMessage.h"
+
+/**
+ * @brief vx (VX APPS) binary log format namespace.
+ *
+ * The stream is a sequence of frames, every frame starts with its Frame tag:
+ * - Header: magic, version, precision and byte order. Starts a new segment, the decoder forgets all sites.
+ * - Site: id, severity, line, supported flag, file, function and format string of a call site. Written once per segment.
+ * - Text: site id, timestamp delta and the message.
+ * - Deferred: site id, timestamp delta, argument count, argument types and the arguments.
+ * - Raw: an already built message.
+ * Numbers are unsigned LEB128 varints, timestamp deltas and signed integers are zigzag encoded,
+ * floating point arguments are raw bytes, texts are prefixed with their length.
+ */
+namespace vx::binary {
+
+  /**
+   * @brief Magic of the header.
+   */
+  constexpr std::string_view magic = "VXLB";
+
+  /**
+   * @brief Version of the format.
+   */
+  constexpr std::uint8_t version = 1;
+
+  /**
+   * @brief Byte order of the raw arguments, checked by the decoder.
+   */
+  constexpr std::uint8_t littleEndian = 1;
+
+  /**
+   * @brief Tags of the frames.
+   */
+  enum class Frame : std::uint8_t {
+
+    Header = 'H',   /**< Start of a segment. */
+    Site = 'S',     /**< Static metadata of a call site. */
+    Text = 'T',     /**< Record with a rendered message. */
+    Deferred = 'D', /**< Record with the raw arguments of the format string. */
+    Raw = 'M'       /**< Already built message. */
+  };
+
+  /**
+   * @brief Append an unsigned varint.
+   * @param _output   Bytes are appended here.
+   * @param _value   Value to append.
+   */
+  inline void appendVarint( std::string &_output,
+                            std::uint64_t _value ) {
+
+    while ( _value >= 0x80 ) {
+
+      _output.push_back( static_cast<char>( ( _value & 0x7F ) | 0x80 ) );
+      _value >>= 7U;
+    }
+    _output.push_back( static_cast<char>( _value ) );
+  }
+
+  /**
+   * @brief Append a text with its length.
+   * @param _output   Bytes are appended here.
+   * @param _text   Text to append.
+   */
+  inline void appendText( std::string &_output,
+                          std::string_view _text ) {
+
+    appendVarint( _output, _text.size() );
+    _output.append( _text );
+  }
+
+  /**
+   * @brief Map a signed value to an unsigned one, small magnitudes stay small.
+   * @param _value   Signed value.
+   * @return Zigzag encoded value.
+   */
+  constexpr std::uint64_t zigzag( std::int64_t _value ) noexcept {
+
+    return ( static_cast<std::uint64_t>( _value ) << 1U ) ^ static_cast<std::uint64_t>( _value >> 63 );
+  }
+
+  /**
+   * @brief Reverse of zigzag().
+   * @param _value   Zigzag encoded value.
+   * @return Signed value.
+   */
+  constexpr std::int64_t unzigzag( std::uint64_t _value ) noexcept {
+
+    return static_cast<std::int64_t>( _value >> 1U ) ^ -static_cast<std::int64_t>( _value & 1U );
+  }
+
+  /**
+   * @brief Load a captured argument.
+   * @param _argument   Raw bytes of the argument.
+   * @return The argument.
+   */
+  template<typename Argument>
+  Argument loadArgument( const char *_argument ) noexcept {
+
+    Argument argument {};
+    std::memcpy( &argument, _argument, sizeof( Argument ) );
+    return argument;
+  }
+
+  /**
+   * @brief Append a captured argument, integers as varint.
+   * @param _output   Bytes are appended here.
+   * @param _type   Argument type.
+   * @param _argument   Raw bytes of the argument.
+   */
+  inline void appendArgument( std::string &_output,
+                              ArgumentType _type,
+                              const char *_argument ) {
+
+    switch ( _type ) {
+
+      case ArgumentType::Int8:
+        appendVarint( _output, zigzag( loadArgument<std::int8_t>( _argument ) ) );
+        break;
+      case ArgumentType::Int16:
+        appendVarint( _output, zigzag( loadArgument<std::int16_t>( _argument ) ) );
+        break;
+      case ArgumentType::Int32:
+        appendVarint( _output, zigzag( loadArgument<std::int32_t>( _argument ) ) );
+        break;
+      case ArgumentType::Int64:
+        appendVarint( _output, zigzag( loadArgument<std::int64_t>( _argument ) ) );
+        break;
+      case ArgumentType::UInt16:
+        appendVarint( _output, loadArgument<std::uint16_t>( _argument ) );
+        break;
+      case ArgumentType::UInt32:
+        appendVarint( _output, loadArgument<std::uint32_t>( _argument ) );
+        break;
+      case ArgumentType::UInt64:
+        appendVarint( _output, loadArgument<std::uint64_t>( _argument ) );
+        break;
+      case ArgumentType::Bool:
+      case ArgumentType::Char:
+      case ArgumentType::UInt8:
+      case ArgumentType::Float:
+      case ArgumentType::Double:
+        _output.append( _argument, argumentSize( _type ) );
+        break;
+      case ArgumentType::Other:
+        break;
+    }
+  }
+
+  /**
+   * @brief Ticks of the precision since epoch.
+   * @param _time   Time point.
+   * @param _precision   Precision of the ticks.
+   * @return Number of ticks.
+   */
+  inline std::int64_t toTicks( std::chrono::system_clock::time_point _time,
+                               timestamp::Precision _precision ) noexcept {
+
+    const auto since = _time.time_since_epoch();
+    switch ( _precision ) {
+
+      case timestamp::Precision::Seconds:
+        return std::chrono::duration_cast<std::chrono::seconds>( since ).count();
+      case timestamp::Precision::MilliSeconds:
+        return std::chrono::duration_cast<std::chrono::milliseconds>( since ).count();
+      case timestamp::Precision::MicroSeconds:
+        return std::chrono::duration_cast<std::chrono::microseconds>( since ).count();
+      case timestamp::Precision::NanoSeconds:
+        break;
+    }
+    return std::chrono::duration_cast<std::chrono::nanoseconds>( since ).count();
+  }
+
+  /**
+   * @brief Reverse of toTicks().
+   * @param _ticks   Number of ticks.
+   * @param _precision   Precision of the ticks.
+   * @return Time point.
+   */
+  inline std::chrono::system_clock::time_point fromTicks( std::int64_t _ticks,
+                                                          timestamp::Precision _precision ) noexcept {
+
+    switch ( _precision ) {
+
+      case timestamp::Precision::Seconds:
+        return std::chrono::system_clock::time_point( std::chrono::duration_cast<std::chrono::system_clock::duration>( std::chrono::seconds( _ticks ) ) );
+      case timestamp::Precision::MilliSeconds:
+        return std::chrono::system_clock::time_point( std::chrono::duration_cast<std::chrono::system_clock::duration>( std::chrono::milliseconds( _ticks ) ) );
+      case timestamp::Precision::MicroSeconds:
+        return std::chrono::system_clock::time_point( std::chrono::duration_cast<std::chrono::system_clock::duration>( std::chrono::microseconds( _ticks ) ) );
+      case timestamp::Precision::NanoSeconds:
+        break;
+    }
+    return std::chrono::system_clock::time_point( std::chrono::duration_cast<std::chrono::system_clock::duration>( std::chrono::nanoseconds( _ticks ) ) );
+  }
+}
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+/* stl header */
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <source_location.hpp>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * @brief vx (VX APPS) namespace.
+ */
+namespace vx {
+
+  class CallSiteRegistry;
+
+  /**
+   * @brief The CallSite class - source location with the parts of a log line rendered up front.
+   * Converted from std::source_location::current(), the compiler folds all parts into constants.
+   * @author Florian Becker <fb\@vxapps.com> (VX APPS)
+   */
+  class CallSite {
+
+  public:
+    /**
+     * @brief Enough digits for every line number.
+     */
+    static constexpr std::size_t lineDigits = 10;
+
+    /**
+     * @brief Id of a call site, that is not registered yet.
+     */
+    static constexpr std::uint32_t unregistered = std::numeric_limits<std::uint32_t>::max();
+
+    /**
+     * @brief Constructor for CallSite, also converts a source location at runtime.
+     * @param _location   Source location information.
+     */
+    constexpr CallSite( const std::source_location &_location ) noexcept
+      : m_file( _location.file_name() ),
+        m_basename( basename( m_file ) ),
+        m_function( _location.function_name() ),
+        m_line( _location.line() ),
+        m_lineText( render( m_line ) ),
+        m_lineLength( length( m_line ) ),
+        m_supported( m_file != "unsupported" ) {}
+
+    /**
+     * @brief Full file name.
+     * @return View on the file name.
+     */
+    [[nodiscard]] constexpr std::string_view file_name() const noexcept { return m_file; }
+
+    /**
+     * @brief File name without directories.
+     * @return View on the file name.
+     */
+    [[nodiscard]] constexpr std::string_view basename() const noexcept { return m_basename; }
+
+    /**
+     * @brief Function name.
+     * @return View on the function name.
+     */
+    [[nodiscard]] constexpr std::string_view function_name() const noexcept { return m_function; }
+
+    /**
+     * @brief Line number.
+     * @return The line number.
+     */
+    [[nodiscard]] constexpr std::uint_least32_t line() const noexcept { return m_line; }
+
+    /**
+     * @brief Rendered line number.
+     * @return View on the digits.
+     */
+    [[nodiscard]] constexpr std::string_view lineText() const noexcept { return { m_lineText.data(), m_lineLength }; }
+
+    /**
+     * @brief Check, if the compiler provides the source location.
+     * @return True, if file, line and function are known.
+     */
+    [[nodiscard]] constexpr bool supported() const noexcept { return m_supported; }
+
+    /**
+     * @brief Id in the CallSiteRegistry.
+     * @return The id or unregistered.
+     */
+    [[nodiscard]] constexpr std::uint32_t site() const noexcept { return m_site; }
+
+  private:
+    /**
+     * @brief The registry assigns the id.
+     */
+    friend class CallSiteRegistry;
+
+    /**
+     * @brief File name without directories.
+     * @param _file   Full file name.
+     * @return View on the file name.
+     */
+    static constexpr std::string_view basename( std::string_view _file ) noexcept {
+
+#if ( defined __GNUC__ || defined __clang__ ) && !defined _WIN32 && defined __cpp_lib_is_constant_evaluated
+      /* the builtin is folded for the file name literal, the loop of find_last_of is not */
+      if ( !std::is_constant_evaluated() ) {
+
+        const char *separator = __builtin_strrchr( _file.data(), '/' );
+        return separator ? std::string_view( separator + 1 ) : _file;
+      }
+#endif
+      const std::size_t separator = _file.find_last_of( "/\\" );
+      return separator == std::string_view::npos ? _file : _file.substr( separator + 1 );
+    }
+
+    /**
+     * @brief Count the digits of the line number.
+     * @param _line   Line number.
+     * @return Number of digits.
+     */
+    static constexpr std::size_t length( std::uint_least32_t _line ) noexcept {
+
+      std::size_t digits = 1;
+      while ( _line >= 10 ) {
+
+        _line /= 10;
+        ++digits;
+      }
+      return digits;
+    }
+
+    /**
+     * @brief Render the line number.
+     * @param _line   Line number.
+     * @return Digits of the line number.
+     */
+    static constexpr std::array<char, lineDigits> render( std::uint_least32_t _line ) noexcept {
+
+      std::array<char, lineDigits> text {};
+      for ( std::size_t i = length( _line ); i > 0; --i ) {
+
+        text[ i - 1 ] = static_cast<char>( '0' + _line % 10 );
+        _line /= 10;
+      }
+      return text;
+    }
+
+    /**
+     * @brief Full file name.
+     */
+    std::string_view m_file;
+
+    /**
+     * @brief File name without directories.
+     */
+    std::string_view m_basename;
+
+    /**
+     * @brief Function name.
+     */
+    std::string_view m_function;
+
+    /**
+     * @brief Line number.
+     */
+    std::uint_least32_t m_line;
+
+    /**
+     * @brief Rendered line number.
+     */
+    std::array<char, lineDigits> m_lineText;
+
+    /**
+     * @brief Number of digits of the line number.
+     */
+    std::size_t m_lineLength;
+
+    /**
+     * @brief Compiler provides the source location.
+     */
+    bool m_supported;
+
+    /**
+     * @brief Id in the CallSiteRegistry.
+     */
+    std::uint32_t m_site = unregistered;
+  };
+}
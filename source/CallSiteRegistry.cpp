@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* stl header */
+#include <functional>
+#include <iostream>
+
+/* local header */
+#include "CallSiteRegistry.h"
+
+namespace vx {
+
+  CallSiteRegistry::CallSiteRegistry() noexcept {
+
+    try {
+
+      static_cast<void>( add( std::source_location::current( "unsupported", "unsupported", 0 ), {}, Severity::Info ) );
+    }
+    catch ( const std::bad_alloc &_exception ) {
+
+      std::cout << _exception.what() << std::endl;
+    }
+  }
+
+  std::vector<CallSiteInfo> CallSiteRegistry::sites() const {
+
+    const std::lock_guard<std::mutex> lock( m_mutex );
+    return { m_sites.begin(), m_sites.end() };
+  }
+
+  std::size_t CallSiteRegistry::KeyHash::operator()( const Key &_key ) const noexcept {
+
+    std::size_t hash = std::hash<std::string_view> {}( _key.file );
+    hash = hash * 31 + std::hash<std::string_view> {}( _key.function );
+    hash = hash * 31 + std::hash<std::string_view> {}( _key.format );
+    hash = hash * 31 + _key.line;
+    return hash * 31 + static_cast<std::size_t>( _key.severity );
+  }
+
+  const CallSiteInfo &CallSiteRegistry::lookup( const CallSite &_location,
+                                                std::string_view _format,
+                                                Severity _severity ) noexcept {
+
+    std::uint32_t id = unknownSite;
+    try {
+
+      const std::lock_guard<std::mutex> lock( m_mutex );
+      const auto known = m_ids.find( { _location.file_name(), _location.function_name(), _format, _location.line(), _severity } );
+      id = known != m_ids.end() ? known->second : add( _location, _format, _severity );
+    }
+    catch ( const std::bad_alloc &_exception ) {
+
+      std::cout << _exception.what() << std::endl;
+    }
+    return site( id );
+  }
+
+  std::uint32_t CallSiteRegistry::add( const CallSite &_location,
+                                       std::string_view _format,
+                                       Severity _severity ) {
+
+    const std::size_t id = m_sites.size();
+    if ( id >= chunkSize * chunkCount ) {
+
+      return unknownSite;
+    }
+    if ( id % chunkSize == 0 ) {
+
+      m_chunkStorage.emplace_back( std::make_unique<std::array<const CallSiteInfo *, chunkSize>>() );
+      m_chunks[ id / chunkSize ].store( m_chunkStorage.back().get(), std::memory_order_release );
+    }
+
+    CallSiteInfo &info = m_sites.emplace_back( CallSiteInfo { _location, _format, _severity } );
+    info.location.m_site = static_cast<std::uint32_t>( id );
+    ( *m_chunkStorage.back() )[ id % chunkSize ] = &info;
+    m_ids.try_emplace( { _location.file_name(), _location.function_name(), _format, _location.line(), _severity }, static_cast<std::uint32_t>( id ) );
+
+    /* publish the site, after it is complete */
+    m_size.store( id + 1, std::memory_order_release );
+    return static_cast<std::uint32_t>( id );
+  }
+}
@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+/* stl header */
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/* modern.cpp.core */
+#include <Singleton.h>
+
+/* local header */
+#include "CallSite.h"
+#include "Logger.h"
+
+/**
+ * @brief vx (VX APPS) namespace.
+ */
+namespace vx {
+
+  /**
+   * @brief The CallSiteInfo struct - static metadata of one call site.
+   */
+  struct CallSiteInfo {
+
+    /**
+     * @brief Source location, with the id of the call site.
+     */
+    CallSite location;
+
+    /**
+     * @brief Format string, empty for plain messages.
+     */
+    std::string_view format {};
+
+    /**
+     * @brief Severity level of the call site.
+     */
+    Severity severity = Severity::Info;
+  };
+
+  /**
+   * @brief The CallSiteRegistry class - interns every call site once and assigns a small id.
+   * Records only carry the id, the static metadata is looked up by the id.
+   * Every thread caches the sites it has seen, only the first use of a site takes the lock.
+   * @author Florian Becker <fb\@vxapps.com> (VX APPS)
+   */
+  class CallSiteRegistry : public Singleton<CallSiteRegistry> {
+
+  public:
+    /**
+     * @brief Number of sites per chunk.
+     */
+    static constexpr std::size_t chunkSize = 256;
+
+    /**
+     * @brief Maximum number of chunks.
+     */
+    static constexpr std::size_t chunkCount = 1024;
+
+    /**
+     * @brief Id of the unknown site, used if the registry is full.
+     */
+    static constexpr std::uint32_t unknownSite = 0;
+
+    /**
+     * @brief Default constructor for CallSiteRegistry - registers the unknown site.
+     */
+    explicit CallSiteRegistry() noexcept;
+
+    /**
+     * @brief Site of the location, registered on first use.
+     * @param _location   Source location information.
+     * @param _format   Format string, empty for plain messages.
+     * @param _severity   Severity level of the call site.
+     * @return The registered site.
+     */
+    [[nodiscard]] const CallSiteInfo &intern( const CallSite &_location,
+                                              std::string_view _format,
+                                              Severity _severity ) noexcept {
+
+      if ( _location.site() != CallSite::unregistered ) {
+
+        return site( _location.site() );
+      }
+
+      /* the string literals of a site have a fixed address, so the pointers identify the site */
+      thread_local std::array<CacheEntry, cacheSize> cache {};
+      const std::size_t slot = ( reinterpret_cast<std::uintptr_t>( _location.file_name().data() ) >> 4U ^ reinterpret_cast<std::uintptr_t>( _format.data() ) >> 4U ^ _location.line() * 0x9E3779B1U ^ static_cast<std::size_t>( _severity ) ) & ( cacheSize - 1 );
+      CacheEntry &entry = cache[ slot ];
+      if ( !entry.info || entry.file != _location.file_name().data() || entry.function != _location.function_name().data() || entry.format != _format.data() || entry.formatSize != _format.size() || entry.line != _location.line() || entry.severity != _severity ) {
+
+        entry = { _location.file_name().data(), _location.function_name().data(), _format.data(), _format.size(), _location.line(), _severity, &lookup( _location, _format, _severity ) };
+      }
+      return *entry.info;
+    }
+
+    /**
+     * @brief Site with the id.
+     * @param _site   Id of the site.
+     * @return The site or the unknown site, if the id is not known.
+     */
+    [[nodiscard]] const CallSiteInfo &site( std::uint32_t _site ) const noexcept {
+
+      if ( _site >= m_size.load( std::memory_order_acquire ) ) {
+
+        return *( *m_chunks[ 0 ].load( std::memory_order_acquire ) )[ unknownSite ];
+      }
+      return *( *m_chunks[ _site / chunkSize ].load( std::memory_order_acquire ) )[ _site % chunkSize ];
+    }
+
+    /**
+     * @brief Number of known sites, including the unknown site.
+     * @return Number of sites.
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return m_size.load( std::memory_order_acquire ); }
+
+    /**
+     * @brief Copy of all known sites, ordered by id.
+     * @return All sites.
+     */
+    [[nodiscard]] std::vector<CallSiteInfo> sites() const;
+
+  private:
+    /**
+     * @brief Number of cached sites per thread.
+     */
+    static constexpr std::size_t cacheSize = 64;
+
+    /**
+     * @brief The CacheEntry struct - site seen by the calling thread.
+     */
+    struct CacheEntry {
+
+      /**
+       * @brief File name of the site.
+       */
+      const char *file;
+
+      /**
+       * @brief Function name of the site.
+       */
+      const char *function;
+
+      /**
+       * @brief Format string of the site.
+       */
+      const char *format;
+
+      /**
+       * @brief Length of the format string.
+       */
+      std::size_t formatSize;
+
+      /**
+       * @brief Line of the site.
+       */
+      std::uint_least32_t line;
+
+      /**
+       * @brief Severity level of the site.
+       */
+      Severity severity;
+
+      /**
+       * @brief The registered site.
+       */
+      const CallSiteInfo *info;
+    };
+
+    /**
+     * @brief The Key struct - content of a site, equal sites of different translation units share the id.
+     */
+    struct Key {
+
+      /**
+       * @brief File name of the site.
+       */
+      std::string_view file {};
+
+      /**
+       * @brief Function name of the site.
+       */
+      std::string_view function {};
+
+      /**
+       * @brief Format string of the site.
+       */
+      std::string_view format {};
+
+      /**
+       * @brief Line of the site.
+       */
+      std::uint_least32_t line = 0;
+
+      /**
+       * @brief Severity level of the site.
+       */
+      Severity severity = Severity::Info;
+
+      /**
+       * @brief Compare two keys.
+       * @param _other   Other key.
+       * @return True, if both are the same site.
+       */
+      bool operator==( const Key &_other ) const noexcept = default;
+    };
+
+    /**
+     * @brief The KeyHash struct - hash of the content of a site.
+     */
+    struct KeyHash {
+
+      /**
+       * @brief Hash the key.
+       * @param _key   Key to hash.
+       * @return The hash.
+       */
+      std::size_t operator()( const Key &_key ) const noexcept;
+    };
+
+    /**
+     * @brief Find or register the site.
+     * @param _location   Source location information.
+     * @param _format   Format string, empty for plain messages.
+     * @param _severity   Severity level of the call site.
+     * @return The registered site.
+     */
+    const CallSiteInfo &lookup( const CallSite &_location,
+                                std::string_view _format,
+                                Severity _severity ) noexcept;
+
+    /**
+     * @brief Register a new site, the lock has to be held.
+     * @param _location   Source location information.
+     * @param _format   Format string, empty for plain messages.
+     * @param _severity   Severity level of the call site.
+     * @return Id of the site or unknownSite, if the registry is full.
+     */
+    std::uint32_t add( const CallSite &_location,
+                       std::string_view _format,
+                       Severity _severity );
+
+    /**
+     * @brief Mutex for registering sites.
+     */
+    mutable std::mutex m_mutex {};
+
+    /**
+     * @brief Storage of the sites, references stay valid.
+     */
+    std::deque<CallSiteInfo> m_sites {};
+
+    /**
+     * @brief Ids of the sites.
+     */
+    std::unordered_map<Key, std::uint32_t, KeyHash> m_ids {};
+
+    /**
+     * @brief Storage of the chunks.
+     */
+    std::vector<std::unique_ptr<std::array<const CallSiteInfo *, chunkSize>>> m_chunkStorage {};
+
+    /**
+     * @brief Chunks of sites by id, read without lock.
+     */
+    std::array<std::atomic<const std::array<const CallSiteInfo *, chunkSize> *>, chunkCount> m_chunks {};
+
+    /**
+     * @brief Number of published sites.
+     */
+    std::atomic<std::size_t> m_size { 0 };
+  };
+}
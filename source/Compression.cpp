@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* system header */
+#ifdef HAVE_LZ4
+  #include <lz4frame.h>
+#endif
+#ifdef HAVE_ZSTD
+  #include <zstd.h>
+#endif
+#ifdef HAVE_ZLIB
+  #include <zlib.h>
+#endif
+
+/* stl header */
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+/* local header */
+#include "Compression.h"
+
+namespace vx::compression {
+
+  /**
+   * @brief Size of the uncompressed frames of a compressed file.
+   */
+  constexpr std::size_t fileFrameSize = 1024 * 1024;
+
+  Codec parse( std::string_view _name ) {
+
+    Codec codec = Codec::None;
+    if ( _name == "lz4" ) {
+
+      codec = Codec::Lz4;
+    }
+    else if ( _name == "zstd" ) {
+
+      codec = Codec::Zstd;
+    }
+    else if ( _name == "gzip" ) {
+
+      codec = Codec::Gzip;
+    }
+    else if ( _name != "none" ) {
+
+      throw std::invalid_argument( std::string( _name ) + " is not a valid compression." );
+    }
+    if ( !available( codec ) ) {
+
+      throw std::invalid_argument( std::string( _name ) + " compression is not built in." );
+    }
+    return codec;
+  }
+
+  bool available( Codec _codec ) noexcept {
+
+    switch ( _codec ) {
+
+      case Codec::None:
+        return true;
+      case Codec::Lz4:
+#ifdef HAVE_LZ4
+        return true;
+#else
+        return false;
+#endif
+      case Codec::Zstd:
+#ifdef HAVE_ZSTD
+        return true;
+#else
+        return false;
+#endif
+      case Codec::Gzip:
+#ifdef HAVE_ZLIB
+        return true;
+#else
+        return false;
+#endif
+    }
+    return false;
+  }
+
+  int defaultLevel( Codec _codec ) noexcept {
+
+    switch ( _codec ) {
+
+      case Codec::Zstd:
+        return 3;
+      case Codec::Gzip:
+        return 6;
+      case Codec::None:
+      case Codec::Lz4:
+        break;
+    }
+    /* the fast mode of lz4 */
+    return 0;
+  }
+
+  std::string_view extension( Codec _codec ) noexcept {
+
+    switch ( _codec ) {
+
+      case Codec::Lz4:
+        return ".lz4";
+      case Codec::Zstd:
+        return ".zst";
+      case Codec::Gzip:
+        return ".gz";
+      case Codec::None:
+        break;
+    }
+    return {};
+  }
+
+  bool compressFrame( Codec _codec,
+                      [[maybe_unused]] int _level,
+                      std::string_view _input,
+                      std::string &_output ) noexcept {
+
+    const std::size_t offset = _output.size();
+    try {
+
+      switch ( _codec ) {
+
+        case Codec::None:
+          _output.append( _input );
+          return true;
+
+        case Codec::Lz4: {
+#ifdef HAVE_LZ4
+          /* the checksum tells a frame, that was cut by a crash */
+          LZ4F_preferences_t preferences {};
+          preferences.frameInfo.contentChecksumFlag = LZ4F_contentChecksumEnabled;
+          preferences.compressionLevel = _level;
+          const std::size_t bound = LZ4F_compressFrameBound( _input.size(), &preferences );
+          _output.resize( offset + bound );
+          const std::size_t size = LZ4F_compressFrame( _output.data() + offset, bound, _input.data(), _input.size(), &preferences );
+          if ( !LZ4F_isError( size ) ) {
+
+            _output.resize( offset + size );
+            return true;
+          }
+          std::cout << "Cannot compress lz4 frame: " << LZ4F_getErrorName( size ) << std::endl;
+#endif
+          break;
+        }
+
+        case Codec::Zstd: {
+#ifdef HAVE_ZSTD
+          /* the context keeps its tables between the frames */
+          thread_local std::unique_ptr<ZSTD_CCtx, decltype( &ZSTD_freeCCtx )> context( ZSTD_createCCtx(), &ZSTD_freeCCtx );
+          if ( !context ) {
+
+            break;
+          }
+          const std::size_t bound = ZSTD_compressBound( _input.size() );
+          _output.resize( offset + bound );
+          const std::size_t size = ZSTD_compressCCtx( context.get(), _output.data() + offset, bound, _input.data(), _input.size(), _level );
+          if ( !ZSTD_isError( size ) ) {
+
+            _output.resize( offset + size );
+            return true;
+          }
+          std::cout << "Cannot compress zstd frame: " << ZSTD_getErrorName( size ) << std::endl;
+#endif
+          break;
+        }
+
+        case Codec::Gzip: {
+#ifdef HAVE_ZLIB
+          if ( _input.size() > std::numeric_limits<uInt>::max() ) {
+
+            break;
+          }
+          /* window bits above 15 write a gzip member instead of a zlib stream */
+          z_stream stream {};
+          if ( deflateInit2( &stream, _level, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY ) != Z_OK ) {
+
+            break;
+          }
+          const std::size_t bound = deflateBound( &stream, static_cast<uLong>( _input.size() ) );
+          _output.resize( offset + bound );
+          stream.next_in = reinterpret_cast<Bytef *>( const_cast<char *>( _input.data() ) );
+          stream.avail_in = static_cast<uInt>( _input.size() );
+          stream.next_out = reinterpret_cast<Bytef *>( _output.data() + offset );
+          stream.avail_out = static_cast<uInt>( bound );
+          const int result = deflate( &stream, Z_FINISH );
+          deflateEnd( &stream );
+          if ( result == Z_STREAM_END ) {
+
+            _output.resize( offset + stream.total_out );
+            return true;
+          }
+          std::cout << "Cannot compress gzip member: " << result << std::endl;
+#endif
+          break;
+        }
+      }
+    }
+    catch ( const std::exception &_exception ) {
+
+      std::cout << _exception.what() << std::endl;
+    }
+    _output.resize( offset );
+    return false;
+  }
+
+  bool compressFile( Codec _codec,
+                     int _level,
+                     const std::string &_source,
+                     const std::string &_target ) noexcept {
+
+    try {
+
+      std::ifstream input( _source, std::ifstream::binary );
+      std::ofstream output( _target, std::ofstream::binary | std::ofstream::trunc );
+      if ( !input.is_open() || !output.is_open() ) {
+
+        std::cout << "Cannot compress " << _source << " to " << _target << std::endl;
+        return false;
+      }
+
+      std::vector<char> chunk( fileFrameSize );
+      std::string frame {};
+      bool compressed = true;
+      while ( compressed && input ) {
+
+        input.read( chunk.data(), static_cast<std::streamsize>( chunk.size() ) );
+        const auto count = static_cast<std::size_t>( input.gcount() );
+        if ( count == 0 ) {
+
+          break;
+        }
+        frame.clear();
+        compressed = compressFrame( _codec, _level, { chunk.data(), count }, frame ) && output.write( frame.data(), static_cast<std::streamsize>( frame.size() ) );
+      }
+      output.close();
+      input.close();
+
+      std::error_code errorCode {};
+      if ( !compressed || !output ) {
+
+        std::filesystem::remove( _target, errorCode );
+        return false;
+      }
+      std::filesystem::remove( _source, errorCode );
+      return true;
+    }
+    catch ( const std::exception &_exception ) {
+
+      std::cout << _exception.what() << std::endl;
+    }
+    return false;
+  }
+}
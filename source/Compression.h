@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+/* stl header */
+#include <string>
+#include <string_view>
+
+/**
+ * @brief vx (VX APPS) compression namespace.
+ *
+ * Every call compresses its input to one complete frame: an LZ4 frame, a zstd frame or a gzip member.
+ * Concatenated frames are a valid stream for lz4, zstd and gzip, each frame decodes on its own,
+ * so a crash loses at most the frame, that was written last. The codecs are optional, HAVE_LZ4,
+ * HAVE_ZSTD and HAVE_ZLIB are defined, when the library is found.
+ */
+namespace vx::compression {
+
+  /**
+   * @brief Enum class for the codecs.
+   */
+  enum class Codec {
+
+    /** No compression */
+    None,
+
+    /** LZ4 frames */
+    Lz4,
+
+    /** Zstandard frames */
+    Zstd,
+
+    /** gzip members */
+    Gzip
+  };
+
+  /**
+   * @brief Parse the codec of the configuration.
+   * @param _name   none, lz4, zstd or gzip.
+   * @return The codec.
+   * @exception std::invalid_argument   If the name is unknown or the codec is not built in.
+   */
+  [[nodiscard]] Codec parse( std::string_view _name ) noexcept( false );
+
+  /**
+   * @brief Check, if the codec is built in.
+   * @param _codec   Codec.
+   * @return True, if the codec is available - otherwise false.
+   */
+  [[nodiscard]] bool available( Codec _codec ) noexcept;
+
+  /**
+   * @brief Default level of the codec.
+   * @param _codec   Codec.
+   * @return The default level.
+   */
+  [[nodiscard]] int defaultLevel( Codec _codec ) noexcept;
+
+  /**
+   * @brief File extension of the codec.
+   * @param _codec   Codec.
+   * @return The extension, including the dot.
+   */
+  [[nodiscard]] std::string_view extension( Codec _codec ) noexcept;
+
+  /**
+   * @brief Compress the input to one frame and append it.
+   * @param _codec   Codec.
+   * @param _level   Compression level.
+   * @param _input   Uncompressed data.
+   * @param _output   The frame is appended.
+   * @return True, if the frame is appended - otherwise false.
+   */
+  bool compressFrame( Codec _codec,
+                      int _level,
+                      std::string_view _input,
+                      std::string &_output ) noexcept;
+
+  /**
+   * @brief Compress a file frame by frame and remove it afterwards.
+   * @param _codec   Codec.
+   * @param _level   Compression level.
+   * @param _source   Uncompressed file.
+   * @param _target   Compressed file.
+   * @return True, if the file is compressed - otherwise false and the source is kept.
+   */
+  bool compressFile( Codec _codec,
+                     int _level,
+                     const std::string &_source,
+                     const std::string &_target ) noexcept;
+}
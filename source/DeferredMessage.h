@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+/* stl header */
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+/* local header */
+#include "Format.h"
+
+/**
+ * @brief vx (VX APPS) namespace.
+ */
+namespace vx {
+
+  /**
+   * @brief Argument types, that can be copied as raw bytes and rendered later.
+   */
+  template<typename Type>
+  constexpr bool isDeferrable = std::is_arithmetic_v<Type> || std::is_enum_v<Type>;
+
+  /**
+   * @brief Type of a captured argument, for rendering it without the C++ type.
+   */
+  enum class ArgumentType : std::uint8_t {
+
+    Other,  /**< Type, that can only be rendered by the format library, e.g. an enum. */
+    Bool,   /**< bool. */
+    Char,   /**< char. */
+    Int8,   /**< Signed 8 bit integer. */
+    Int16,  /**< Signed 16 bit integer. */
+    Int32,  /**< Signed 32 bit integer. */
+    Int64,  /**< Signed 64 bit integer. */
+    UInt8,  /**< Unsigned 8 bit integer. */
+    UInt16, /**< Unsigned 16 bit integer. */
+    UInt32, /**< Unsigned 32 bit integer. */
+    UInt64, /**< Unsigned 64 bit integer. */
+    Float,  /**< float. */
+    Double  /**< double. */
+  };
+
+  /**
+   * @brief Type of a captured argument.
+   * @return The argument type.
+   */
+  template<typename Type>
+  constexpr ArgumentType argumentType() noexcept {
+
+    if constexpr ( std::is_same_v<Type, bool> ) {
+
+      return ArgumentType::Bool;
+    }
+    else if constexpr ( std::is_same_v<Type, char> ) {
+
+      return ArgumentType::Char;
+    }
+    else if constexpr ( std::is_same_v<Type, float> ) {
+
+      return ArgumentType::Float;
+    }
+    else if constexpr ( std::is_same_v<Type, double> ) {
+
+      return ArgumentType::Double;
+    }
+    else if constexpr ( std::is_integral_v<Type> && !std::is_same_v<Type, wchar_t> && !std::is_same_v<Type, char16_t> && !std::is_same_v<Type, char32_t> && sizeof( Type ) <= 8 ) {
+
+      constexpr std::size_t index = sizeof( Type ) == 1 ? 0 : sizeof( Type ) == 2 ? 1 : sizeof( Type ) == 4 ? 2 : 3;
+      return static_cast<ArgumentType>( static_cast<std::size_t>( std::is_signed_v<Type> ? ArgumentType::Int8 : ArgumentType::UInt8 ) + index );
+    }
+    else {
+
+      return ArgumentType::Other;
+    }
+  }
+
+  /**
+   * @brief Size of a captured argument.
+   * @param _type   Argument type.
+   * @return Size in bytes, zero for ArgumentType::Other.
+   */
+  constexpr std::size_t argumentSize( ArgumentType _type ) noexcept {
+
+    switch ( _type ) {
+
+      case ArgumentType::Bool:
+      case ArgumentType::Char:
+      case ArgumentType::Int8:
+      case ArgumentType::UInt8:
+        return 1;
+      case ArgumentType::Int16:
+      case ArgumentType::UInt16:
+        return 2;
+      case ArgumentType::Int32:
+      case ArgumentType::UInt32:
+      case ArgumentType::Float:
+        return 4;
+      case ArgumentType::Int64:
+      case ArgumentType::UInt64:
+      case ArgumentType::Double:
+        return 8;
+      case ArgumentType::Other:
+        break;
+    }
+    return 0;
+  }
+
+  /**
+   * @brief The DeferredMessage class - format string and arguments captured as raw bytes.
+   * The text is rendered later with the format library, e.g. on the backend thread of the async logger.
+   * @author Florian Becker <fb\@vxapps.com> (VX APPS)
+   */
+  class DeferredMessage {
+
+  public:
+    /**
+     * @brief Bytes available for the arguments.
+     */
+    static constexpr std::size_t argumentCapacity = 64;
+
+    /**
+     * @brief Default constructor for an empty DeferredMessage.
+     */
+    DeferredMessage() = default;
+
+    /**
+     * @brief Capture the format string and the arguments.
+     * @param _format   Format string literal, checked against the arguments by the caller.
+     * @param _arguments   Arithmetic or enum arguments.
+     */
+    template<typename... Arguments>
+    explicit DeferredMessage( std::string_view _format,
+                              const Arguments &..._arguments ) noexcept
+      : m_format( _format ),
+        m_render( &render<Arguments...> ),
+        m_types( typesOf<Arguments...>.data() ),
+        m_count( static_cast<std::uint8_t>( sizeof...( Arguments ) ) ),
+        m_size( static_cast<std::uint8_t>( ( sizeof( Arguments ) + ... + 0 ) ) ) {
+
+      static_assert( ( isDeferrable<Arguments> && ... ), "Only arithmetic and enum arguments can be deferred." );
+      static_assert( ( sizeof( Arguments ) + ... + 0 ) <= argumentCapacity, "Too many arguments to defer." );
+
+      std::size_t offset = 0;
+      ( store( _arguments, offset ), ... );
+    }
+
+    /**
+     * @brief Check, if nothing is captured.
+     * @return True, if there is no renderer.
+     */
+    [[nodiscard]] bool empty() const noexcept { return m_render == nullptr; }
+
+    /**
+     * @brief Format string.
+     * @return View on the format string literal.
+     */
+    [[nodiscard]] std::string_view format() const noexcept { return m_format; }
+
+    /**
+     * @brief Number of captured arguments.
+     * @return Number of arguments.
+     */
+    [[nodiscard]] std::size_t argumentCount() const noexcept { return m_count; }
+
+    /**
+     * @brief Types of the captured arguments.
+     * @return argumentCount() types.
+     */
+    [[nodiscard]] const ArgumentType *argumentTypes() const noexcept { return m_types; }
+
+    /**
+     * @brief Captured arguments as raw bytes, one after the other.
+     * @return View on the bytes.
+     */
+    [[nodiscard]] std::string_view arguments() const noexcept { return { reinterpret_cast<const char *>( m_arguments.data() ), m_size }; }
+
+    /**
+     * @brief Render the message.
+     * @param _output   Text is appended here.
+     */
+    void render( std::string &_output ) const noexcept( false ) {
+
+      if ( m_render ) {
+
+        m_render( m_format, m_arguments.data(), _output );
+      }
+    }
+
+  private:
+    /**
+     * @brief Types of the arguments.
+     */
+    template<typename... Arguments>
+    static constexpr std::array<ArgumentType, sizeof...( Arguments )> typesOf { argumentType<Arguments>()... };
+
+    /**
+     * @brief Copy one argument into the buffer.
+     * @param _argument   Argument to copy.
+     * @param _offset   Offset in the buffer, moved behind the argument.
+     */
+    template<typename Argument>
+    void store( const Argument &_argument,
+                std::size_t &_offset ) noexcept {
+
+      std::memcpy( m_arguments.data() + _offset, &_argument, sizeof( Argument ) );
+      _offset += sizeof( Argument );
+    }
+
+    /**
+     * @brief Copy one argument out of the buffer.
+     * @param _arguments   Captured arguments.
+     * @param _offset   Offset in the buffer, moved behind the argument.
+     * @return The argument.
+     */
+    template<typename Argument>
+    static Argument load( const std::byte *_arguments,
+                          std::size_t &_offset ) noexcept {
+
+      Argument argument {};
+      std::memcpy( &argument, _arguments + _offset, sizeof( Argument ) );
+      _offset += sizeof( Argument );
+      return argument;
+    }
+
+    /**
+     * @brief Render the format string with the captured arguments.
+     * @param _format   Format string.
+     * @param _arguments   Captured arguments.
+     * @param _output   Text is appended here.
+     */
+    template<typename... Arguments>
+    static void render( std::string_view _format,
+                        const std::byte *_arguments,
+                        std::string &_output ) {
+
+      std::size_t offset = 0;
+      /* the braced list loads the arguments in order */
+      const std::tuple<Arguments...> arguments { load<Arguments>( _arguments, offset )... };
+      std::apply( [ &_output, _format ]( const auto &..._argument ) { formatTo( _output, _format, makeFormatArguments( _argument... ) ); }, arguments );
+    }
+
+    /**
+     * @brief Format string literal.
+     */
+    std::string_view m_format {};
+
+    /**
+     * @brief Renderer, that knows the types of the captured arguments.
+     */
+    void ( *m_render )( std::string_view, const std::byte *, std::string & ) = nullptr;
+
+    /**
+     * @brief Types of the captured arguments.
+     */
+    const ArgumentType *m_types = nullptr;
+
+    /**
+     * @brief Number of captured arguments.
+     */
+    std::uint8_t m_count = 0;
+
+    /**
+     * @brief Number of used bytes.
+     */
+    std::uint8_t m_size = 0;
+
+    /**
+     * @brief Captured arguments as raw bytes.
+     */
+    std::array<std::byte, argumentCapacity> m_arguments {};
+  };
+}
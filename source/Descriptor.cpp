@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* system header */
+#if defined __unix__ || defined __APPLE__
+  #include <sys/uio.h>
+  #include <unistd.h>
+#endif
+
+/* stl header */
+#include <array>
+#include <cerrno>
+#include <cstddef>
+
+/* local header */
+#include "Descriptor.h"
+
+namespace vx::descriptor {
+
+  /**
+   * @brief Parts per writev, below IOV_MAX of all POSIX systems.
+   */
+  constexpr std::size_t vectorSize = 256;
+
+#if defined __unix__ || defined __APPLE__
+  /**
+   * @brief Write all parts with writev, only a short write continues with the rest.
+   * @param _descriptor   File descriptor.
+   * @param _vector   Parts, a short write changes them.
+   * @param _count   Number of parts, at most vectorSize.
+   * @return True, if everything is written - otherwise false.
+   */
+  static bool writeVector( int _descriptor,
+                           iovec *_vector,
+                           int _count ) noexcept {
+
+    iovec *next = _vector;
+    int count = _count;
+    while ( count > 0 ) {
+
+      const ssize_t written = ::writev( _descriptor, next, count );
+      if ( written < 0 ) {
+
+        if ( errno == EINTR ) {
+
+          continue;
+        }
+        return false;
+      }
+
+      auto remaining = static_cast<std::size_t>( written );
+      while ( count > 0 && remaining >= next->iov_len ) {
+
+        remaining -= next->iov_len;
+        ++next;
+        --count;
+      }
+      if ( count > 0 ) {
+
+        next->iov_base = static_cast<char *>( next->iov_base ) + remaining;
+        next->iov_len -= remaining;
+      }
+    }
+    return true;
+  }
+#endif
+
+  bool writeAll( int _descriptor,
+                 std::span<const std::string_view> _parts ) noexcept {
+
+#if defined __unix__ || defined __APPLE__
+    /* only the filled parts are read, zeroing the whole vector would cost more than most writes */
+    std::array<iovec, vectorSize> vector;
+    std::size_t part = 0;
+    while ( part < _parts.size() ) {
+
+      int count = 0;
+      for ( ; part < _parts.size() && static_cast<std::size_t>( count ) < vector.size(); ++part ) {
+
+        if ( !_parts[ part ].empty() ) {
+
+          vector[ static_cast<std::size_t>( count ) ] = { const_cast<char *>( _parts[ part ].data() ), _parts[ part ].size() };
+          ++count;
+        }
+      }
+      if ( !writeVector( _descriptor, vector.data(), count ) ) {
+
+        return false;
+      }
+    }
+    return true;
+#else
+    static_cast<void>( _descriptor );
+    static_cast<void>( _parts );
+    return false;
+#endif
+  }
+}
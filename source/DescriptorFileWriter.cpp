@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* system header */
+#if defined __unix__ || defined __APPLE__
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
+
+/* stl header */
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <utility>
+
+/* local header */
+#include "Descriptor.h"
+#include "DescriptorFileWriter.h"
+
+namespace vx {
+
+  DescriptorFileWriter::DescriptorFileWriter( FileWriterSettings _settings ) noexcept
+      : FileWriter( std::move( _settings ) ) {}
+
+  DescriptorFileWriter::~DescriptorFileWriter() noexcept {
+
+#if defined __unix__ || defined __APPLE__
+    /* no writer is left */
+    if ( const int descriptor = m_descriptor.exchange( -1 ); descriptor >= 0 ) {
+
+      ::close( descriptor );
+    }
+#endif
+  }
+
+  bool DescriptorFileWriter::open() noexcept {
+
+#if defined __unix__ || defined __APPLE__
+    const int descriptor = ::open( settings().filename.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC | O_APPEND, 0644 );
+    if ( descriptor < 0 ) {
+
+      std::cout << "Cannot open " << settings().filename << ": " << std::strerror( errno ) << std::endl;
+      return false;
+    }
+
+    /* writers only load the file descriptor, the former one is closed, after they left */
+    const int previous = m_descriptor.exchange( descriptor, std::memory_order_acq_rel );
+    if ( previous >= 0 ) {
+
+      m_epochs.synchronize();
+      ::close( previous );
+    }
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  void DescriptorFileWriter::writeDescriptor( std::span<const std::string_view> _parts,
+                                              bool _sync ) noexcept {
+
+    /* open closes a replaced file descriptor after all writers left */
+    const EpochGuard guard( m_epochs );
+    const int descriptor = m_descriptor.load( std::memory_order_acquire );
+    if ( !descriptor::writeAll( descriptor, _parts ) ) {
+
+      std::cout << "Cannot write " << settings().filename << ": " << std::strerror( errno ) << std::endl;
+    }
+
+#if defined __unix__ || defined __APPLE__
+    if ( _sync ) {
+
+  #if defined __APPLE__
+      ::fsync( descriptor );
+  #else
+      ::fdatasync( descriptor );
+  #endif
+    }
+#else
+    static_cast<void>( _sync );
+#endif
+  }
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+/* stl header */
+#include <atomic>
+#include <span>
+#include <string_view>
+
+/* local header */
+#include "EpochDomain.h"
+#include "FileWriter.h"
+
+/**
+ * @brief vx (VX APPS) namespace.
+ */
+namespace vx {
+
+  /**
+   * @brief The DescriptorFileWriter class - base of the writers to a file descriptor opened with O_APPEND (POSIX only).
+   * Writers only load the file descriptor, a newly opened file replaces it at once and the former one
+   * is closed, after all writers left it.
+   * @author Florian Becker <fb\@vxapps.com> (VX APPS)
+   */
+  class DescriptorFileWriter : public FileWriter {
+
+  public:
+    /**
+     * @brief Constructor for DescriptorFileWriter.
+     * @param _settings   Flush policy.
+     */
+    explicit DescriptorFileWriter( FileWriterSettings _settings ) noexcept;
+
+    /**
+     * @brief Destructor for DescriptorFileWriter - closes the file.
+     */
+    ~DescriptorFileWriter() noexcept override;
+
+    /**
+     * @brief Open the log file again, the records switch to it at once.
+     * @return True, if the file is opened.
+     */
+    bool open() noexcept override;
+
+    /**
+     * @brief Nothing to switch, open already did.
+     * @return Always false.
+     */
+    bool replace() noexcept override { return false; }
+
+    /**
+     * @brief Nothing to close, open already did.
+     * @return Always true.
+     */
+    bool closeRetired() noexcept override { return true; }
+
+  protected:
+    /**
+     * @brief Write the parts with as few writev calls as possible.
+     * @param _parts   Text to write, in order.
+     * @param _sync   Write the file to the disk with fdatasync afterwards.
+     */
+    void writeDescriptor( std::span<const std::string_view> _parts,
+                          bool _sync = false ) noexcept;
+
+  private:
+    /**
+     * @brief File descriptor of the log file.
+     */
+    std::atomic<int> m_descriptor { -1 };
+
+    /**
+     * @brief Writers are readers of the file descriptor until it is closed.
+     */
+    EpochDomain m_epochs {};
+  };
+}
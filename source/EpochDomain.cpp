@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* system header */
+#if defined __linux__
+  #include <linux/membarrier.h>
+  #include <sys/syscall.h>
+  #include <unistd.h>
+#endif
+
+/* stl header */
+#include <thread>
+
+/* local header */
+#include "EpochDomain.h"
+
+namespace vx {
+
+  /**
+   * @brief Register for expedited process wide memory barriers.
+   * @return True, if heavyBarrier() is available.
+   */
+  static bool registerHeavyBarrier() noexcept {
+
+#if defined __linux__ && defined __NR_membarrier
+    static const bool registered = syscall( __NR_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0 ) == 0;
+    return registered;
+#else
+    return false;
+#endif
+  }
+
+  /**
+   * @brief Issue a memory barrier on every running thread of the process.
+   */
+  static void heavyBarrier() noexcept {
+
+#if defined __linux__ && defined __NR_membarrier
+    syscall( __NR_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0 );
+#endif
+  }
+
+  EpochDomain::EpochDomain() noexcept
+    : m_asymmetric( registerHeavyBarrier() ) {}
+
+  EpochDomain::Reader &EpochDomain::enter() noexcept {
+
+    Reader &reader = m_readers.local();
+    if ( reader.depth++ == 0 ) {
+
+      reader.epoch.store( m_epoch.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+      /* the epoch must be visible, before the shared pointer is loaded */
+      /* with process wide barriers the writer pays for the fence */
+      if ( m_asymmetric ) {
+
+        std::atomic_signal_fence( std::memory_order_seq_cst );
+      }
+      else {
+
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+      }
+    }
+    return reader;
+  }
+
+  void EpochDomain::leave( Reader &_reader ) noexcept {
+
+    if ( --_reader.depth == 0 ) {
+
+      _reader.epoch.store( 0, std::memory_order_release );
+    }
+  }
+
+  void EpochDomain::synchronize() noexcept {
+
+    const std::uint64_t target = m_epoch.fetch_add( 1, std::memory_order_seq_cst ) + 1;
+    if ( m_asymmetric ) {
+
+      heavyBarrier();
+    }
+    else {
+
+      std::atomic_thread_fence( std::memory_order_seq_cst );
+    }
+
+    /* readers of an older epoch might still see the replaced object */
+    for ( const auto &entry : m_readers.snapshot() ) {
+
+      while ( true ) {
+
+        const std::uint64_t epoch = entry->value.epoch.load( std::memory_order_acquire );
+        if ( epoch == 0 || epoch >= target ) {
+
+          break;
+        }
+        std::this_thread::yield();
+      }
+    }
+
+    /* exited threads are never inside a read section */
+    m_readers.collect( []( [[maybe_unused]] const Reader &_reader ) { return true; } );
+  }
+}
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+/* stl header */
+#include <atomic>
+#include <cstdint>
+
+/* local header */
+#include "ThreadRegistry.h"
+
+/**
+ * @brief vx (VX APPS) namespace.
+ */
+namespace vx {
+
+  /**
+   * @brief The EpochDomain class - epoch based reclamation of shared objects.
+   * Readers only publish the epoch they entered in their own slot, a writer
+   * swaps the shared pointer and waits with synchronize() until no reader of
+   * an older epoch is left, before the old object is destroyed. On Linux the
+   * reader side fence is moved to the writer with membarrier(2).
+   * @author Florian Becker <fb\@vxapps.com> (VX APPS)
+   */
+  class EpochDomain {
+
+  public:
+    /**
+     * @brief The Reader struct - read section state of one thread.
+     */
+    struct Reader {
+
+      /**
+       * @brief Epoch the thread entered, zero if outside of a read section.
+       */
+      std::atomic<std::uint64_t> epoch { 0 };
+
+      /**
+       * @brief Nesting depth, only touched by the owning thread.
+       */
+      std::uint32_t depth = 0;
+    };
+
+    /**
+     * @brief Default constructor for EpochDomain.
+     */
+    EpochDomain() noexcept;
+
+    /**
+     * @brief Deleted copy constructor.
+     */
+    EpochDomain( const EpochDomain & ) = delete;
+
+    /**
+     * @brief Deleted move constructor.
+     */
+    EpochDomain( EpochDomain && ) = delete;
+
+    /**
+     * @brief Default destructor for EpochDomain.
+     */
+    ~EpochDomain() = default;
+
+    /**
+     * @brief Deleted copy assign operator.
+     */
+    EpochDomain &operator=( const EpochDomain & ) = delete;
+
+    /**
+     * @brief Deleted move assign operator.
+     */
+    EpochDomain &operator=( EpochDomain && ) = delete;
+
+    /**
+     * @brief Enter a read section, nested sections are allowed.
+     * @return Reader state of the calling thread.
+     */
+    Reader &enter() noexcept;
+
+    /**
+     * @brief Leave a read section.
+     * @param _reader   Reader state returned by enter().
+     */
+    static void leave( Reader &_reader ) noexcept;
+
+    /**
+     * @brief Wait until all readers, which might still see a replaced object, left their read section.
+     * Must not be called inside a read section.
+     */
+    void synchronize() noexcept;
+
+  private:
+    /**
+     * @brief Readers only need a compiler fence, as writers issue process wide barriers.
+     */
+    const bool m_asymmetric = false;
+
+    /**
+     * @brief Current epoch.
+     */
+    std::atomic<std::uint64_t> m_epoch { 1 };
+
+    /**
+     * @brief Reader state per thread.
+     */
+    ThreadRegistry<Reader> m_readers {};
+  };
+
+  /**
+   * @brief The EpochGuard class - read section for the lifetime of the guard.
+   * @author Florian Becker <fb\@vxapps.com> (VX APPS)
+   */
+  class EpochGuard {
+
+  public:
+    /**
+     * @brief Constructor for EpochGuard, enters the read section.
+     * @param _domain   Epoch domain.
+     */
+    explicit EpochGuard( EpochDomain &_domain ) noexcept
+      : m_reader( _domain.enter() ) {}
+
+    /**
+     * @brief Deleted copy constructor.
+     */
+    EpochGuard( const EpochGuard & ) = delete;
+
+    /**
+     * @brief Deleted move constructor.
+     */
+    EpochGuard( EpochGuard && ) = delete;
+
+    /**
+     * @brief Destructor for EpochGuard, leaves the read section.
+     */
+    ~EpochGuard() noexcept { EpochDomain::leave( m_reader ); }
+
+    /**
+     * @brief Deleted copy assign operator.
+     */
+    EpochGuard &operator=( const EpochGuard & ) = delete;
+
+    /**
+     * @brief Deleted move assign operator.
+     */
+    EpochGuard &operator=( EpochGuard && ) = delete;
+
+  private:
+    /**
+     * @brief Reader state of the calling thread.
+     */
+    EpochDomain::Reader &m_reader;
+  };
+}
@@ -0,0 +1,304 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* system header */
+#if defined __SSE2__ || defined _M_X64
+  #include <immintrin.h>
+#elif defined __ARM_NEON
+  #include <arm_neon.h>
+#endif
+
+/* stl header */
+#include <bit>
+#include <cstdint>
+
+/* local header */
+#include "Escape.h"
+
+#if defined __GNUC__ && defined __x86_64__ && defined __SSE2__ && !defined __AVX2__
+  /**
+   * @brief AVX2 is selected at runtime, when the build does not target it already.
+   */
+  #define VX_ESCAPE_DISPATCH_AVX2
+#endif
+
+namespace vx::escape {
+
+  /**
+   * @brief Replacement of control characters, that XML 1.0 does not allow: U+FFFD in UTF-8.
+   */
+  constexpr std::string_view replacementCharacter = "\xEF\xBF\xBD";
+
+  /**
+   * @brief Hex digits of the JSON \\u escape.
+   */
+  constexpr std::string_view hexDigits = "0123456789abcdef";
+
+  /**
+   * @brief Check, if the character needs the slow path of the escaper.
+   * Control characters are always special.
+   * @tparam Specials   Further special characters.
+   * @param _char   Character.
+   * @return True, if the character is special - otherwise false.
+   */
+  template <char... Specials>
+  static inline bool isSpecial( char _char ) noexcept {
+
+    return static_cast<unsigned char>( _char ) < 0x20 || ( ( _char == Specials ) || ... );
+  }
+
+  /**
+   * @brief Find the next special character without SIMD.
+   * @tparam Specials   Special characters besides the control characters.
+   * @param _data   Text.
+   * @param _position   Start of the search.
+   * @param _size   Size of the text.
+   * @return Position of the special character or the size, if there is none.
+   */
+  template <char... Specials>
+  static std::size_t findScalar( const char *_data,
+                                 std::size_t _position,
+                                 std::size_t _size ) noexcept {
+
+    while ( _position < _size && !isSpecial<Specials...>( _data[ _position ] ) ) {
+
+      ++_position;
+    }
+    return _position;
+  }
+
+#if defined __SSE2__ || defined _M_X64
+  /**
+   * @brief Find the next special character, 16 bytes at a time.
+   * @tparam Specials   Special characters besides the control characters.
+   * @param _data   Text.
+   * @param _position   Start of the search.
+   * @param _size   Size of the text.
+   * @return Position of the special character or the size, if there is none.
+   */
+  template <char... Specials>
+  static std::size_t findSse2( const char *_data,
+                               std::size_t _position,
+                               std::size_t _size ) noexcept {
+
+    const __m128i control = _mm_set1_epi8( 0x1F );
+    for ( ; _position + sizeof( __m128i ) <= _size; _position += sizeof( __m128i ) ) {
+
+      const __m128i block = _mm_loadu_si128( reinterpret_cast<const __m128i *>( _data + _position ) );
+      /* max( block, 0x1F ) == 0x1F is an unsigned block <= 0x1F */
+      __m128i special = _mm_cmpeq_epi8( _mm_max_epu8( block, control ), control );
+      ( ( special = _mm_or_si128( special, _mm_cmpeq_epi8( block, _mm_set1_epi8( Specials ) ) ) ), ... );
+      const auto mask = static_cast<unsigned int>( _mm_movemask_epi8( special ) );
+      if ( mask != 0 ) {
+
+        return _position + static_cast<std::size_t>( std::countr_zero( mask ) );
+      }
+    }
+    return findScalar<Specials...>( _data, _position, _size );
+  }
+
+  #if defined __AVX2__ || defined VX_ESCAPE_DISPATCH_AVX2
+  /**
+   * @brief Find the next special character, 32 bytes at a time.
+   * @tparam Specials   Special characters besides the control characters.
+   * @param _data   Text.
+   * @param _position   Start of the search.
+   * @param _size   Size of the text.
+   * @return Position of the special character or the size, if there is none.
+   */
+  template <char... Specials>
+    #ifdef VX_ESCAPE_DISPATCH_AVX2
+  __attribute__( ( target( "avx2" ) ) )
+    #endif
+  static std::size_t findAvx2( const char *_data,
+                               std::size_t _position,
+                               std::size_t _size ) noexcept {
+
+    const __m256i control = _mm256_set1_epi8( 0x1F );
+    for ( ; _position + sizeof( __m256i ) <= _size; _position += sizeof( __m256i ) ) {
+
+      const __m256i block = _mm256_loadu_si256( reinterpret_cast<const __m256i *>( _data + _position ) );
+      __m256i special = _mm256_cmpeq_epi8( _mm256_max_epu8( block, control ), control );
+      ( ( special = _mm256_or_si256( special, _mm256_cmpeq_epi8( block, _mm256_set1_epi8( Specials ) ) ) ), ... );
+      const auto mask = static_cast<unsigned int>( _mm256_movemask_epi8( special ) );
+      if ( mask != 0 ) {
+
+        return _position + static_cast<std::size_t>( std::countr_zero( mask ) );
+      }
+    }
+    /* the tail is shorter than 32 bytes, one more 16 byte block might still fit,
+       clear the upper halves first, legacy SSE code after AVX code is slow otherwise */
+    _mm256_zeroupper();
+    return findSse2<Specials...>( _data, _position, _size );
+  }
+  #endif
+#elif defined __ARM_NEON
+  /**
+   * @brief Find the next special character, 16 bytes at a time.
+   * @tparam Specials   Special characters besides the control characters.
+   * @param _data   Text.
+   * @param _position   Start of the search.
+   * @param _size   Size of the text.
+   * @return Position of the special character or the size, if there is none.
+   */
+  template <char... Specials>
+  static std::size_t findNeon( const char *_data,
+                               std::size_t _position,
+                               std::size_t _size ) noexcept {
+
+    const uint8x16_t control = vdupq_n_u8( 0x20 );
+    for ( ; _position + sizeof( uint8x16_t ) <= _size; _position += sizeof( uint8x16_t ) ) {
+
+      const uint8x16_t block = vld1q_u8( reinterpret_cast<const std::uint8_t *>( _data + _position ) );
+      uint8x16_t special = vcltq_u8( block, control );
+      ( ( special = vorrq_u8( special, vceqq_u8( block, vdupq_n_u8( static_cast<std::uint8_t>( Specials ) ) ) ) ), ... );
+      /* narrow every byte to 4 bits, there is no movemask on NEON */
+      const uint8x8_t narrowed = vshrn_n_u16( vreinterpretq_u16_u8( special ), 4 );
+      const std::uint64_t mask = vget_lane_u64( vreinterpret_u64_u8( narrowed ), 0 );
+      if ( mask != 0 ) {
+
+        return _position + static_cast<std::size_t>( std::countr_zero( mask ) / 4 );
+      }
+    }
+    return findScalar<Specials...>( _data, _position, _size );
+  }
+#endif
+
+#ifdef VX_ESCAPE_DISPATCH_AVX2
+  /**
+   * @brief AVX2 support of the CPU, checked once.
+   * Before the dynamic initialization it is false and SSE2 is used.
+   */
+  static const bool hasAvx2 = __builtin_cpu_supports( "avx2" );
+#endif
+
+  /**
+   * @brief Find the next special character with the best instruction set.
+   * @tparam Specials   Special characters besides the control characters.
+   * @param _data   Text.
+   * @param _position   Start of the search.
+   * @param _size   Size of the text.
+   * @return Position of the special character or the size, if there is none.
+   */
+  template <char... Specials>
+  static std::size_t find( const char *_data,
+                           std::size_t _position,
+                           std::size_t _size ) noexcept {
+
+#if defined __AVX2__
+    return findAvx2<Specials...>( _data, _position, _size );
+#elif defined VX_ESCAPE_DISPATCH_AVX2
+    return hasAvx2 ? findAvx2<Specials...>( _data, _position, _size ) : findSse2<Specials...>( _data, _position, _size );
+#elif defined __SSE2__ || defined _M_X64
+    return findSse2<Specials...>( _data, _position, _size );
+#elif defined __ARM_NEON
+    return findNeon<Specials...>( _data, _position, _size );
+#else
+    return findScalar<Specials...>( _data, _position, _size );
+#endif
+  }
+
+  void appendXml( std::string &_output,
+                  std::string_view _text ) noexcept {
+
+    const char *data = _text.data();
+    const std::size_t size = _text.size();
+    std::size_t start = 0;
+    for ( std::size_t position = find<'&', '<', '>'>( data, 0, size ); position < size; position = find<'&', '<', '>'>( data, start, size ) ) {
+
+      _output.append( data + start, position - start );
+      switch ( data[ position ] ) {
+
+        case '&':
+          _output.append( "&amp;" );
+          break;
+        case '<':
+          _output.append( "&lt;" );
+          break;
+        case '>':
+          _output.append( "&gt;" );
+          break;
+        case '\t':
+        case '\n':
+        case '\r':
+          _output.push_back( data[ position ] );
+          break;
+        default:
+          _output.append( replacementCharacter );
+          break;
+      }
+      start = position + 1;
+    }
+    _output.append( data + start, size - start );
+  }
+
+  void appendJson( std::string &_output,
+                   std::string_view _text ) noexcept {
+
+    const char *data = _text.data();
+    const std::size_t size = _text.size();
+    std::size_t start = 0;
+    for ( std::size_t position = find<'"', '\\'>( data, 0, size ); position < size; position = find<'"', '\\'>( data, start, size ) ) {
+
+      _output.append( data + start, position - start );
+      switch ( data[ position ] ) {
+
+        case '"':
+          _output.append( "\\\"" );
+          break;
+        case '\\':
+          _output.append( "\\\\" );
+          break;
+        case '\b':
+          _output.append( "\\b" );
+          break;
+        case '\f':
+          _output.append( "\\f" );
+          break;
+        case '\n':
+          _output.append( "\\n" );
+          break;
+        case '\r':
+          _output.append( "\\r" );
+          break;
+        case '\t':
+          _output.append( "\\t" );
+          break;
+        default:
+          _output.append( "\\u00" );
+          _output.push_back( hexDigits[ static_cast<unsigned char>( data[ position ] ) >> 4 ] );
+          _output.push_back( hexDigits[ static_cast<unsigned char>( data[ position ] ) & 0x0F ] );
+          break;
+      }
+      start = position + 1;
+    }
+    _output.append( data + start, size - start );
+  }
+}
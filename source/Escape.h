@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+/* stl header */
+#include <string>
+#include <string_view>
+
+/**
+ * @brief vx (VX APPS) escape namespace.
+ *
+ * Log text is mostly plain, so the escapers search the next special character 16 or 32 bytes
+ * at a time (SSE2, AVX2 or NEON, scalar otherwise) and append the plain runs in one piece.
+ */
+namespace vx::escape {
+
+  /**
+   * @brief Append the text as XML character data.
+   * &, < and > become entity references. Control characters, that XML 1.0 does not allow,
+   * become U+FFFD, tab, newline and carriage return are kept.
+   * @param _output   Text is appended here.
+   * @param _text   Text to escape.
+   */
+  void appendXml( std::string &_output,
+                  std::string_view _text ) noexcept;
+
+  /**
+   * @brief Append the text as content of a JSON string.
+   * Quotes and backslashes are escaped, control characters become \\n, \\t and so on or \\u00XX.
+   * @param _output   Text is appended here.
+   * @param _text   Text to escape.
+   */
+  void appendJson( std::string &_output,
+                   std::string_view _text ) noexcept;
+}
@@ -28,28 +28,31 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+/* system header */
+#if defined __unix__ || defined __APPLE__
+  #include <sys/stat.h>
+#endif
+
 /* stl header */
 #include <algorithm>
+#include <filesystem>
 #include <iostream>
 #include <mutex>
 #if defined __GNUC__ && __GNUC__ >= 10 || defined _MSC_VER && _MSC_VER >= 1929 || defined __clang__ && __clang_major__ >= 15
   #include <ranges>
 #endif
 
-/* magic enum */
-#include <magic_enum.hpp>
-
-/* modern.cpp.core */
-#include <StringUtils.h>
-#include <Timestamp.h>
-
 /* local header */
+#include "AppendFileWriter.h"
 #include "FileLogger.h"
+#include "GroupFileWriter.h"
+#include "SeverityLabel.h"
+#include "StreamFileWriter.h"
+#include "TimestampCache.h"
+#include "UringFileWriter.h"
 
 namespace vx {
 
-  using timestamp::Precision;
-
   /**
    * @brief Reserved overhead for new log entry.
    */
@@ -60,8 +63,81 @@ namespace vx {
    */
   constexpr int reopenInterval = 300;
 
+  /**
+   * @brief Default buffer size in bytes.
+   */
+  constexpr std::size_t bufferSize = 65536;
+
+  /**
+   * @brief Default maximum age of a buffered record in milliseconds.
+   */
+  constexpr std::size_t flushInterval = 1000;
+
+  /**
+   * @brief Interval for checking the size of the log file.
+   */
+  constexpr std::chrono::milliseconds sizeCheckInterval { 100 };
+
+  /**
+   * @brief Interval for checking the age of the log file and the reopen interval.
+   */
+  constexpr std::chrono::milliseconds rotationCheckInterval { 1000 };
+
+  /**
+   * @brief Shortest interval for writing expired buffers.
+   */
+  constexpr std::chrono::milliseconds flushCheckInterval { 10 };
+
+  /**
+   * @brief Default number of io_uring buffers.
+   */
+  constexpr std::size_t uringBuffers = 4;
+
+  /**
+   * @brief Read the file mode.
+   * @param _configuration   Logger configuration.
+   * @return Output for mode uring, group, append or stream.
+   */
+  static FileOutput configuredOutput( const std::unordered_map<std::string, std::string> &_configuration ) {
+
+    const auto mode = _configuration.find( "mode" );
+    if ( mode == _configuration.end() || mode->second == "stream" ) {
+
+      return FileOutput::Stream;
+    }
+    if ( mode->second != "append" && mode->second != "uring" && mode->second != "group" ) {
+
+      throw std::invalid_argument( mode->second + " is not a valid file mode." );
+    }
+#if defined __unix__ || defined __APPLE__
+    if ( mode->second == "group" ) {
+
+      return FileOutput::Group;
+    }
+#endif
+#if defined __linux__
+    if ( mode->second == "uring" && !UringWriter::available() ) {
+
+      std::cout << "io_uring is not available, using mode append." << std::endl;
+      return FileOutput::Append;
+    }
+    return mode->second == "uring" ? FileOutput::Uring : FileOutput::Append;
+#elif defined __unix__ || defined __APPLE__
+    return FileOutput::Append;
+#else
+    std::cout << "File mode " << mode->second << " needs O_APPEND and writev, using mode stream." << std::endl;
+    return FileOutput::Stream;
+#endif
+  }
+
   FileLogger::FileLogger( const std::unordered_map<std::string, std::string> &_configuration )
-      : Logger( _configuration ) {
+      : FileLogger( _configuration, std::ofstream::out | std::ofstream::app, configuredOutput( _configuration ) ) {}
+
+  FileLogger::FileLogger( const std::unordered_map<std::string, std::string> &_configuration,
+                          std::ios_base::openmode _mode,
+                          FileOutput _output )
+      : Logger( _configuration ),
+        m_output( _output ) {
 
     /* grab the file name */
     const auto name = _configuration.find( "filename" );
@@ -72,118 +148,358 @@ namespace vx {
     m_filename = name->second;
 
     /* if we specify an interval */
-    m_reopenInterval = std::chrono::seconds( reopenInterval );
-    const auto interval = _configuration.find( "reopen_interval" );
-    if ( interval != _configuration.end() ) {
+    m_reopenInterval = std::chrono::seconds( configuredValue( _configuration, "reopen_interval", vx::reopenInterval ) );
+
+    /* flush policy */
+    FileWriterSettings settings { m_filename };
+    settings.bufferSize = configuredValue( _configuration, "buffer_size", bufferSize );
+    settings.flushInterval = std::chrono::milliseconds( configuredValue( _configuration, "flush_interval", flushInterval ) );
+    if ( const auto severity = _configuration.find( "flush_severity" ); severity != _configuration.end() ) {
+
+      const auto value = severityFromName( severity->second );
+      if ( !value ) {
+
+        throw std::invalid_argument( severity->second + " is not a valid flush severity." );
+      }
+      settings.flushSeverity = *value;
+    }
+    const std::size_t ringBuffers = configuredValue( _configuration, "uring_buffers", uringBuffers );
+    if ( ringBuffers == 0 ) {
+
+      throw std::invalid_argument( "Number of io_uring buffers cannot be zero." );
+    }
+    bool uringFixed = true;
+    if ( const auto fixed = _configuration.find( "uring_fixed" ); fixed != _configuration.end() ) {
+
+      if ( fixed->second != "true" && fixed->second != "false" ) {
+
+        throw std::invalid_argument( fixed->second + " is not a valid uring_fixed, use true or false." );
+      }
+      uringFixed = fixed->second == "true";
+    }
+    bool groupSync = false;
+    if ( const auto sync = _configuration.find( "group_sync" ); sync != _configuration.end() ) {
+
+      if ( sync->second != "true" && sync->second != "false" ) {
+
+        throw std::invalid_argument( sync->second + " is not a valid group_sync, use true or false." );
+      }
+      groupSync = sync->second == "true";
+    }
+
+    /* rotation and retention */
+    m_maxSize = configuredValue( _configuration, "max_size", 0 );
+    m_maxAge = std::chrono::seconds( configuredValue( _configuration, "max_age", 0 ) );
+    m_maxFiles = configuredValue( _configuration, "max_files", 0 );
+
+    /* compression of the records or of the rotated files */
+    if ( const auto codec = _configuration.find( "compression" ); codec != _configuration.end() ) {
+
+      m_compression = compression::parse( codec->second );
+    }
+    m_compressionLevel = compression::defaultLevel( m_compression );
+    if ( const auto level = _configuration.find( "compression_level" ); level != _configuration.end() ) {
 
       try {
 
-        m_reopenInterval = std::chrono::seconds( std::stoul( interval->second ) );
+        m_compressionLevel = std::stoi( level->second );
       }
       catch ( const std::invalid_argument &_exception ) {
 
         std::cout << _exception.what() << std::endl;
-        throw std::invalid_argument( interval->second + " is not a valid reopen interval." );
+        throw std::invalid_argument( level->second + " is not a valid compression_level." );
       }
       catch ( const std::out_of_range &_exception ) {
 
         std::cout << _exception.what() << std::endl;
-        throw std::out_of_range( interval->second + " is out of range reopen interval." );
+        throw std::out_of_range( level->second + " is out of range compression_level." );
       }
-      catch ( const std::exception &_exception ) {
+    }
+    if ( const auto mode = _configuration.find( "compression_mode" ); mode != _configuration.end() ) {
 
-        /* nothing to do */
-        std::cout << _exception.what() << std::endl;
+      if ( mode->second != "stream" && mode->second != "rotated" ) {
+
+        throw std::invalid_argument( mode->second + " is not a valid compression_mode, use stream or rotated." );
       }
+      m_compressRotated = mode->second == "rotated";
     }
+    if ( m_compression != compression::Codec::None && !m_compressRotated && m_output != FileOutput::Stream && m_output != FileOutput::Derived ) {
 
-    m_file.exceptions( std::ofstream::failbit | std::ofstream::badbit );
+      throw std::invalid_argument( "Compressed records need file mode stream, use compression_mode rotated." );
+    }
 
-    /* open the file */
-    open();
-  }
+    /* a derived output opens the file on its own */
+    if ( m_output == FileOutput::Derived ) {
 
-  FileLogger::~FileLogger() noexcept {
+      return;
+    }
 
-    try {
+    /* the background thread writes a lone buffered record */
+    if ( m_output != FileOutput::Group && settings.bufferSize > 0 ) {
 
-      if ( m_file.is_open() ) {
+      m_flushInterval = settings.flushInterval;
+    }
 
-        m_file.close();
+    /* the writer of the file mode */
+    switch ( m_output ) {
+
+      case FileOutput::Append:
+        m_writer = std::make_unique<AppendFileWriter>( std::move( settings ) );
+        break;
+      case FileOutput::Group:
+        m_writer = std::make_unique<GroupFileWriter>( std::move( settings ), groupSync );
+        break;
+      case FileOutput::Uring: {
+        const std::size_t ringBufferSize = settings.bufferSize > 0 ? settings.bufferSize : bufferSize;
+        m_writer = std::make_unique<UringFileWriter>( std::move( settings ), ringBufferSize, ringBuffers, uringFixed );
+        break;
+      }
+      default: {
+        const bool compressRecords = m_compression != compression::Codec::None && !m_compressRotated;
+        m_writer = std::make_unique<StreamFileWriter>( std::move( settings ), _mode, compressRecords ? m_compression : compression::Codec::None, m_compressionLevel );
+        break;
       }
     }
-    catch ( const std::exception &_exception ) {
 
-      /* nothing to do, file cannot be closed. */
-      std::cout << _exception.what() << std::endl;
+    /* open the file */
+    open();
+    replaceFile();
+
+    /* the background thread only runs for a job */
+    if ( m_flushInterval.count() > 0 || rotates() || m_reopenInterval.count() > 0 ) {
+
+      m_rotation = std::thread( &FileLogger::run, this );
     }
   }
 
-  void FileLogger::log( std::string_view _message,
-                        Severity _severity,
-                        const std::source_location &_location ) noexcept {
+  FileLogger::~FileLogger() noexcept {
 
-    if ( avoidLogBelow > _severity ) {
+    {
+      const std::lock_guard<std::mutex> lock( m_rotationMutex );
+      m_stop = true;
+    }
+    m_rotationCondition.notify_one();
+    if ( m_rotation.joinable() ) {
 
-      return;
+      m_rotation.join();
     }
 
+    /* no writer is left, write everything to the current file and close all */
+    m_writer.reset();
+
+    /* the last rotation before the stop */
+    if ( m_compressPending ) {
+
+      const std::string rotated = m_filename + ".1";
+      compression::compressFile( m_compression, m_compressionLevel, rotated, rotated + std::string( compression::extension( m_compression ) ) );
+    }
+  }
+
+  void FileLogger::log( const LogRecord &_record ) noexcept {
+
+    const std::string_view message = Logger::message( _record );
     std::string output {};
-    output.reserve( _message.size() + fileOverhead );
-    output.append( timestamp::iso8601( Precision::MicroSeconds ) );
+    output.reserve( message.size() + fileOverhead );
+    TimestampCache::local().append( output, precision(), _record.timeOrNow() );
 
-    std::string severity( magic_enum::enum_name( _severity ) );
-    string_utils::toUpper( severity );
-    output.append( " [" + severity + "] " );
-    if ( std::string( _location.file_name() ) != "unsupported" ) {
+    output.append( severityLabel( _record.severity, false ) );
+    if ( _record.location && _record.location->supported() ) {
 
-      output.append( _location.file_name() );
+      output.append( _record.location->file_name() );
       output.push_back( ':' );
-      output.append( std::to_string( _location.line() ) );
+      output.append( _record.location->lineText() );
       output.push_back( ' ' );
-      output.append( _location.function_name() );
+      output.append( _record.location->function_name() );
       output.push_back( ' ' );
     }
-    output.append( _message );
+    output.append( message );
     output.push_back( '\n' );
 
-    log( output );
+    write( output, _record.severity );
   }
 
   void FileLogger::log( std::string_view _message ) noexcept {
 
-    const std::unique_lock<std::shared_mutex> lock( m_mutex );
+    /* already built messages have no severity, they follow the buffer size and the flush interval */
+    write( _message, Severity::Verbose );
+  }
+
+  void FileLogger::flush() noexcept {
+
+    if ( m_writer ) {
+
+      m_writer->flush();
+    }
+  }
+
+  void FileLogger::write( std::string_view _text,
+                          Severity _severity ) noexcept {
 
-    m_file << _message;
-    m_file.flush();
+    if ( m_writer ) {
+
+      m_writer->write( _text, _severity );
+    }
+  }
+
+  void FileLogger::ignoreMode( const std::unordered_map<std::string, std::string> &_configuration,
+                               std::string_view _logger,
+                               std::string_view _instead ) {
+
+    const auto mode = _configuration.find( "mode" );
+    if ( mode == _configuration.end() || mode->second == "stream" ) {
+
+      return;
+    }
+    if ( mode->second != "append" && mode->second != "uring" && mode->second != "group" ) {
+
+      throw std::invalid_argument( mode->second + " is not a valid file mode." );
+    }
+    std::cout << "File mode " << mode->second << " is not supported by the " << _logger << " logger, " << _instead << "." << std::endl;
   }
 
   void FileLogger::open() noexcept {
 
-    /* check if it should be closed and reopened */
-    const auto now = std::chrono::system_clock::now();
-    /* there seams to be some kind of issue, if you directly use this with */
-    /* clang-10 and clang-11 and c++2a - because this will return a */
-    /* zero-as-null-pointer-contant warning. */
-    const auto diff = std::chrono::duration_cast<std::chrono::seconds>( now - m_lastReopen );
-    if ( diff.count() > m_reopenInterval.count() ) {
+    if ( !m_writer || !m_writer->open() ) {
 
-      m_lastReopen = now;
+      return;
+    }
+    m_opened = std::chrono::steady_clock::now();
 
-      try {
+#if defined __unix__ || defined __APPLE__
+    /* remember the file, to notice when it is moved away */
+    struct stat status {};
+    if ( ::stat( m_filename.c_str(), &status ) == 0 ) {
+
+      m_device = static_cast<std::uint64_t>( status.st_dev );
+      m_inode = static_cast<std::uint64_t>( status.st_ino );
+    }
+#endif
+  }
+
+  bool FileLogger::replaceFile() noexcept {
+
+    return m_writer && m_writer->replace();
+  }
 
-        if ( m_file.is_open() ) {
+  void FileLogger::setReplaceOnWrite( bool _replace ) noexcept {
 
-          m_file.close();
+    if ( m_writer ) {
+
+      m_writer->setReplaceOnWrite( _replace );
+    }
+  }
+
+  void FileLogger::shiftFiles() noexcept {
+
+    try {
+
+      /* with compression_mode rotated, all files except the newest filename.1 are compressed */
+      const std::string extension = m_compressRotated ? std::string( compression::extension( m_compression ) ) : std::string();
+      const auto rotated = [ this, &extension ]( std::size_t _index ) { return m_filename + "." + std::to_string( _index ) + extension; };
+
+      std::error_code errorCode {};
+      std::size_t last = 0;
+      while ( std::filesystem::exists( rotated( last + 1 ), errorCode ) ) {
+
+        ++last;
+      }
+      for ( std::size_t index = last; index > 0; --index ) {
+
+        if ( m_maxFiles > 0 && index >= m_maxFiles ) {
+
+          std::filesystem::remove( rotated( index ), errorCode );
+        }
+        else {
+
+          std::filesystem::rename( rotated( index ), rotated( index + 1 ), errorCode );
         }
-        m_file.open( m_filename, std::ofstream::out | std::ofstream::app );
       }
-      catch ( const std::exception &_exception ) {
+      std::filesystem::rename( m_filename, m_filename + ".1", errorCode );
+      if ( errorCode ) {
 
-        /* nothing to do, file is not open or cannot be closed. */
-        std::cout << _exception.what() << std::endl;
+        std::cout << "Cannot rotate " << m_filename << ": " << errorCode.message() << std::endl;
+      }
+      else {
+
+        m_compressPending = m_compressRotated && m_compression != compression::Codec::None;
+      }
+    }
+    catch ( const std::exception &_exception ) {
+
+      std::cout << _exception.what() << std::endl;
+    }
+  }
+
+  void FileLogger::checkFile( std::chrono::steady_clock::time_point _now ) noexcept {
+
+    /* only the rotation and mode uring need the size */
+    std::error_code errorCode {};
+    std::uintmax_t size = 0;
+    if ( rotates() || m_output == FileOutput::Uring ) {
+
+      size = std::filesystem::file_size( m_filename, errorCode );
+    }
+    const bool written = !errorCode && size > 0;
+    if ( written && ( ( m_maxSize > 0 && size >= m_maxSize ) || ( m_maxAge.count() > 0 && _now - m_opened >= m_maxAge ) ) ) {
+
+      shiftFiles();
+      open();
+    }
+    else if ( m_output == FileOutput::Uring && !errorCode && size < m_size ) {
+
+      /* truncated in place, e.g. by copytruncate, io_uring writes at own offsets, the new file continues at its end */
+      open();
+    }
+#if defined __unix__ || defined __APPLE__
+    else if ( m_reopenInterval.count() > 0 && _now - m_lastReopen >= m_reopenInterval ) {
+
+      /* the file was moved away, e.g. by logrotate */
+      m_lastReopen = _now;
+      struct stat status {};
+      if ( ::stat( m_filename.c_str(), &status ) != 0 || static_cast<std::uint64_t>( status.st_dev ) != m_device || static_cast<std::uint64_t>( status.st_ino ) != m_inode ) {
+
+        open();
+      }
+    }
+#endif
+    m_size = errorCode ? 0 : size;
+
+    /* close the former files, outside of the lock of the writers */
+    const bool replaced = m_writer->closeRetired();
+
+    /* filename.1 is closed, once the writers switched to the new file */
+    if ( m_compressPending && replaced ) {
+
+      m_compressPending = false;
+      const std::string rotated = m_filename + ".1";
+      compression::compressFile( m_compression, m_compressionLevel, rotated, rotated + std::string( compression::extension( m_compression ) ) );
+    }
+  }
+
+  void FileLogger::run() noexcept {
+
+    m_lastReopen = std::chrono::steady_clock::now();
+    auto lastCheck = m_lastReopen;
+    const auto checkInterval = m_maxSize > 0 ? sizeCheckInterval : rotationCheckInterval;
+
+    /* a buffered record is written at the latest one wake up after it expired */
+    const auto wakeInterval = m_flushInterval.count() > 0 ? std::clamp<std::chrono::milliseconds>( m_flushInterval, flushCheckInterval, checkInterval ) : checkInterval;
+
+    std::unique_lock<std::mutex> lock( m_rotationMutex );
+    while ( !m_rotationCondition.wait_for( lock, wakeInterval, [ this ] { return m_stop; } ) ) {
+
+      lock.unlock();
+      const auto now = std::chrono::steady_clock::now();
+      if ( m_flushInterval.count() > 0 ) {
+
+        m_writer->flushExpired( now );
+      }
+      if ( now - lastCheck >= checkInterval ) {
+
+        lastCheck = now;
+        checkFile( now );
       }
-      m_lastReopen = std::chrono::system_clock::now();
+      lock.lock();
     }
   }
 }
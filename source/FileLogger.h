@@ -31,13 +31,21 @@
 #pragma once
 
 /* stl header */
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <fstream>
-#include <shared_mutex>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <unordered_map>
 
 /* local header */
+#include "Compression.h"
+#include "FileWriter.h"
 #include "Logger.h"
 
 /**
@@ -45,8 +53,40 @@
  */
 namespace vx {
 
+  /**
+   * @brief Enum for the output of the file logger.
+   */
+  enum class FileOutput {
+    Stream,  /**< Buffered file stream, shared by all threads. */
+    Append,  /**< Buffer per thread, written with writev to an O_APPEND file descriptor. */
+    Uring,   /**< Buffers in flight through io_uring, falls back to Append. */
+    Group,   /**< Every record is written before log returns, one writev writes the records of all waiting threads. */
+    Derived  /**< The derived logger opens and writes the file on its own. */
+  };
+
   /**
    * @brief The FileLogger class for writing messages to file.
+   * Records are collected in a buffer of buffer_size bytes and written together, when it is full,
+   * when the oldest pending record is older than flush_interval milliseconds (checked with the next record and
+   * by the background thread, so a lone record waits at most twice the interval)
+   * or when a record has at least flush_severity.
+   * With mode append (POSIX only) every thread collects its records in an own buffer and writes it
+   * with one writev to a file descriptor opened with O_APPEND, so threads do not wait for each other
+   * and lines of different threads never interleave. The records of different threads are in the order their buffers
+   * are written, not in the order they were logged. The background thread writes the buffer of an exited thread.
+   * With mode uring (Linux only) the records are collected in uring_buffers buffers of buffer_size bytes,
+   * that are written through io_uring while the logger fills the next one. Without io_uring it uses mode append.
+   * As every buffer is written at its own offset, the logger has to own the file: other writers are overwritten and
+   * a truncation in place (copytruncate) is only noticed by the next size check, writes until then leave a sparse hole.
+   * With mode group (POSIX only) every record is in the file, when log returns. The first thread becomes the leader
+   * and writes its record and the records, that other threads posted meanwhile, with one writev, the others wait
+   * for it. With group_sync every group is also written to the disk with fdatasync.
+   * A background thread rotates the file after max_size bytes or max_age seconds, keeps max_files rotated files
+   * and reopens it every reopen_interval seconds, if it was moved away, e.g. by logrotate. The thread is only started,
+   * when rotation, reopening or the timed flush of a buffer is configured. The records switch to the new file without any syscall.
+   * With compression (mode stream only) every buffer is written as one lz4, zstd or gzip frame, with compression_mode
+   * rotated the file stays plain text and the background thread compresses every rotated file instead.
+   * Every file mode is a FileWriter, the logger itself opens, rotates and reopens the file.
    * @author Florian Becker <fb\@vxapps.com> (VX APPS)
    */
   class FileLogger : public Logger {
@@ -68,15 +108,13 @@ namespace vx {
      */
     ~FileLogger() noexcept override;
 
+    using Logger::log;
+
     /**
-     * @brief Build the log message.
-     * @param _message   Message to log.
-     * @param _severity   Severity level of the message.
-     * @param _location   Source location information.
+     * @brief Render the record and write it.
+     * @param _record   Record to log.
      */
-    void log( std::string_view _message,
-              Severity _severity,
-              const std::source_location &_location = std::source_location::current() ) noexcept override;
+    void log( const LogRecord &_record ) noexcept override;
 
     /**
      * @brief Output the log message.
@@ -84,36 +122,196 @@ namespace vx {
      */
     void log( std::string_view _message ) noexcept override;
 
+    /**
+     * @brief Write all buffered records to the file.
+     */
+    void flush() noexcept override;
+
   protected:
     /**
-     * @brief Close and reopen the log file.
+     * @brief Constructor for FileLogger with a specific open mode.
+     * @param _configuration   Logger configuration.
+     * @param _mode   Mode for opening the log file, e.g. with std::ofstream::binary.
+     * @param _output   Output of the records.
+     */
+    FileLogger( const std::unordered_map<std::string, std::string> &_configuration,
+                std::ios_base::openmode _mode,
+                FileOutput _output = FileOutput::Stream ) noexcept( false );
+
+    /**
+     * @brief Warn about a configured file mode, for a logger that always writes in its own way.
+     * @param _configuration   Logger configuration.
+     * @param _logger   Type of the logger.
+     * @param _instead   How the logger writes instead.
+     * @exception std::invalid_argument   If the mode is not a valid file mode.
+     */
+    static void ignoreMode( const std::unordered_map<std::string, std::string> &_configuration,
+                            std::string_view _logger,
+                            std::string_view _instead ) noexcept( false );
+
+    /**
+     * @brief Open the log file again, the records switch to it with the next write.
      */
     void open() noexcept;
 
+    /**
+     * @brief Switch to a newly opened log file.
+     * @return True, if the records go to a new file from now on.
+     */
+    bool replaceFile() noexcept;
+
+    /**
+     * @brief Switch to a newly opened log file with the next write.
+     * @param _replace   False, if the derived logger calls replaceFile on its own, e.g. to start the file with a header.
+     */
+    void setReplaceOnWrite( bool _replace ) noexcept;
+
+    /**
+     * @brief Buffer the text and flush it, as configured.
+     * @param _text   Text to write.
+     * @param _severity   Severity level of the text.
+     */
+    virtual void write( std::string_view _text,
+                        Severity _severity ) noexcept;
+
+    /**
+     * @brief Log filename, configured with filename.
+     * @return The filename.
+     */
+    [[nodiscard]] const std::string &filename() const noexcept { return m_filename; }
+
+    /**
+     * @brief Interval for reopening the log file, configured with reopen_interval.
+     * @return The interval.
+     */
+    [[nodiscard]] std::chrono::seconds reopenInterval() const noexcept { return m_reopenInterval; }
+
   private:
+    /**
+     * @brief Rename the log file to filename.1 and shift the older ones, only max_files are kept.
+     */
+    void shiftFiles() noexcept;
+
+    /**
+     * @brief The file is rotated by size or by age.
+     * @return True, if max_size or max_age is configured.
+     */
+    [[nodiscard]] bool rotates() const noexcept { return m_maxSize > 0 || m_maxAge.count() > 0; }
+
+    /**
+     * @brief Rotate and reopen the log file and close the former ones, only called by the background thread.
+     * @param _now   Current time.
+     */
+    void checkFile( std::chrono::steady_clock::time_point _now ) noexcept;
+
+    /**
+     * @brief Background thread, writes expired buffers and checks the log file.
+     */
+    void run() noexcept;
+
     /**
      * @brief Log filename.
      */
     std::string m_filename {};
 
     /**
-     * @brief Log file handle.
+     * @brief Output of the records.
+     */
+    FileOutput m_output = FileOutput::Stream;
+
+    /**
+     * @brief Writer of the file mode, nullptr with a derived output.
+     */
+    std::unique_ptr<FileWriter> m_writer {};
+
+    /**
+     * @brief Maximum age of a buffered record, that the background thread writes, zero without buffering.
      */
-    std::ofstream m_file {};
+    std::chrono::milliseconds m_flushInterval {};
 
     /**
-     * @brief Interval for reopening the log file.
+     * @brief Interval for checking, if the log file was moved away, zero never checks.
      */
     std::chrono::seconds m_reopenInterval {};
 
     /**
-     * @brief Timestamp of last reopen activity.
+     * @brief Timestamp of last reopen check, only used by the background thread.
+     */
+    std::chrono::steady_clock::time_point m_lastReopen {};
+
+    /**
+     * @brief Rotate after this size in bytes, zero never rotates by size.
+     */
+    std::size_t m_maxSize = 0;
+
+    /**
+     * @brief Rotate after this age, zero never rotates by age.
+     */
+    std::chrono::seconds m_maxAge {};
+
+    /**
+     * @brief Number of rotated files to keep, zero keeps all.
+     */
+    std::size_t m_maxFiles = 0;
+
+    /**
+     * @brief Time, when the current file was opened, only used by the background thread.
+     */
+    std::chrono::steady_clock::time_point m_opened {};
+
+    /**
+     * @brief Size of the file at the last check, only used by the background thread.
+     */
+    std::uintmax_t m_size = 0;
+
+    /**
+     * @brief Device of the current file, only used by the background thread.
+     */
+    std::uint64_t m_device = 0;
+
+    /**
+     * @brief Inode of the current file, only used by the background thread.
+     */
+    std::uint64_t m_inode = 0;
+
+    /**
+     * @brief Codec of the records or of the rotated files.
+     */
+    compression::Codec m_compression = compression::Codec::None;
+
+    /**
+     * @brief Compression level.
+     */
+    int m_compressionLevel = 0;
+
+    /**
+     * @brief Compress the rotated files on the background thread instead of the records.
+     */
+    bool m_compressRotated = false;
+
+    /**
+     * @brief The file filename.1 waits for its compression, only used by the background thread.
+     */
+    bool m_compressPending = false;
+
+    /**
+     * @brief Background thread is asked to stop, guarded by m_rotationMutex.
+     */
+    bool m_stop = false;
+
+    /**
+     * @brief Mutex for waking up the background thread.
+     */
+    std::mutex m_rotationMutex {};
+
+    /**
+     * @brief Condition for waking up the background thread.
      */
-    std::chrono::system_clock::time_point m_lastReopen {};
+    std::condition_variable m_rotationCondition {};
 
     /**
-     * @brief Member for shared mutex.
+     * @brief Background thread.
      */
-    mutable std::shared_mutex m_mutex {};
+    std::thread m_rotation {};
   };
 }
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+/* stl header */
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+
+/* local header */
+#include "Logger.h"
+
+/**
+ * @brief vx (VX APPS) namespace.
+ */
+namespace vx {
+
+  /**
+   * @brief The FileWriterSettings struct - flush policy of a file writer.
+   */
+  struct FileWriterSettings {
+
+    /**
+     * @brief Log filename.
+     */
+    std::string filename {};
+
+    /**
+     * @brief Size of the buffer, zero writes every record.
+     */
+    std::size_t bufferSize = 0;
+
+    /**
+     * @brief Maximum age of a buffered record.
+     */
+    std::chrono::milliseconds flushInterval {};
+
+    /**
+     * @brief Records with at least this severity are written immediately.
+     */
+    Severity flushSeverity = Severity::Error;
+  };
+
+  /**
+   * @brief The FileWriter class - writes the records of a file logger for one file mode.
+   * The file logger opens the file again after a rotation or when it was moved away, every writer decides,
+   * when the records switch to the new file. Log, flush and the background thread call it concurrently.
+   * @author Florian Becker <fb\@vxapps.com> (VX APPS)
+   */
+  class FileWriter {
+
+  public:
+    /**
+     * @brief Deleted default constructor for FileWriter.
+     */
+    FileWriter() = delete;
+
+    /**
+     * @brief Constructor for FileWriter.
+     * @param _settings   Flush policy.
+     */
+    explicit FileWriter( FileWriterSettings _settings ) noexcept
+      : m_settings( std::move( _settings ) ) {}
+
+    /**
+     * @brief Deleted copy constructor.
+     */
+    FileWriter( const FileWriter & ) = delete;
+
+    /**
+     * @brief Deleted move constructor.
+     */
+    FileWriter( FileWriter && ) = delete;
+
+    /**
+     * @brief Default destructor for FileWriter.
+     */
+    virtual ~FileWriter() noexcept = default;
+
+    /**
+     * @brief Deleted copy assign operator.
+     */
+    FileWriter &operator=( const FileWriter & ) = delete;
+
+    /**
+     * @brief Deleted move assign operator.
+     */
+    FileWriter &operator=( FileWriter && ) = delete;
+
+    /**
+     * @brief Open the log file again.
+     * @return True, if the file is opened.
+     */
+    virtual bool open() noexcept = 0;
+
+    /**
+     * @brief Switch to the newly opened file.
+     * @return True, if the records go to a new file from now on.
+     */
+    virtual bool replace() noexcept = 0;
+
+    /**
+     * @brief Buffer the text and write it, as configured.
+     * @param _text   Text to write.
+     * @param _severity   Severity level of the text.
+     */
+    virtual void write( std::string_view _text,
+                        Severity _severity ) noexcept = 0;
+
+    /**
+     * @brief Write all buffered records to the file.
+     */
+    virtual void flush() noexcept = 0;
+
+    /**
+     * @brief Write the buffers, whose oldest record is older than the flush interval, called by the background thread.
+     * @param _now   Current time.
+     */
+    virtual void flushExpired( std::chrono::steady_clock::time_point _now ) noexcept = 0;
+
+    /**
+     * @brief Close the former files, called by the background thread of the file logger.
+     * @return True, if no opened file waits for the records.
+     */
+    virtual bool closeRetired() noexcept = 0;
+
+    /**
+     * @brief Switch to a newly opened file with the next write, writers that switch on open ignore it.
+     * @param _replace   False, if the owner calls replace on its own, e.g. to start the file with a header.
+     */
+    void setReplaceOnWrite( bool _replace ) noexcept { m_replaceOnWrite.store( _replace, std::memory_order_relaxed ); }
+
+  protected:
+    /**
+     * @brief Flush policy.
+     * @return The settings.
+     */
+    [[nodiscard]] const FileWriterSettings &settings() const noexcept { return m_settings; }
+
+    /**
+     * @brief Switch to a newly opened file with the next write.
+     * @return True, if write calls replace.
+     */
+    [[nodiscard]] bool replaceOnWrite() const noexcept { return m_replaceOnWrite.load( std::memory_order_relaxed ); }
+
+  private:
+    /**
+     * @brief Flush policy.
+     */
+    const FileWriterSettings m_settings;
+
+    /**
+     * @brief Switch to a newly opened file with the next write.
+     */
+    std::atomic<bool> m_replaceOnWrite { true };
+  };
+}
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+/* stl header */
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+/* format header */
+#if defined HAVE_FORMAT
+  #include <format>
+#else
+  #ifdef __clang__
+    #pragma clang diagnostic push
+    #pragma clang diagnostic ignored "-Weverything"
+  #endif
+  #ifdef __GNUC__
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Weffc++"
+  #endif
+  #include <fmt/core.h>
+  #ifdef __GNUC__
+    #pragma GCC diagnostic pop
+  #endif
+  #ifdef __clang__
+    #pragma clang diagnostic pop
+  #endif
+#endif
+
+/* local header */
+#include "CallSite.h"
+
+/**
+ * @brief vx (VX APPS) namespace.
+ */
+namespace vx {
+
+#if defined HAVE_FORMAT
+  /**
+   * @brief Format string, checked against the argument types at compile time.
+   */
+  template<typename... Arguments>
+  using FormatString = std::format_string<Arguments...>;
+
+  /**
+   * @brief Type erased format arguments.
+   */
+  using FormatArguments = std::format_args;
+
+  /**
+   * @brief Keep a template argument out of deduction.
+   */
+  template<typename Type>
+  using FormatIdentity = std::type_identity_t<Type>;
+#else
+  /**
+   * @brief Format string, checked against the argument types at compile time.
+   */
+  template<typename... Arguments>
+  using FormatString = fmt::format_string<Arguments...>;
+
+  /**
+   * @brief Type erased format arguments.
+   */
+  using FormatArguments = fmt::format_args;
+
+  /**
+   * @brief Keep a template argument out of deduction.
+   */
+  template<typename Type>
+  using FormatIdentity = fmt::type_identity_t<Type>;
+#endif
+
+  /**
+   * @brief The FormatLocation struct - checked format string and the location of the call.
+   * Both are evaluated at compile time, including the rendered call site.
+   */
+  template<typename... Arguments>
+  struct FormatLocation {
+
+    /**
+     * @brief Constructor for FormatLocation, rejects format strings not matching the arguments.
+     * @param _format   Format string literal.
+     * @param _location   Source location information.
+     */
+    template<typename Text, std::enable_if_t<std::is_convertible_v<const Text &, std::string_view>, int> = 0>
+#if defined __cpp_consteval
+    consteval
+#else
+    constexpr
+#endif
+    FormatLocation( const Text &_format,
+                    const std::source_location &_location = std::source_location::current() )
+      : format( _format ),
+        location( _location ) {}
+
+    /**
+     * @brief Text of the format string.
+     * @return View on the format string literal.
+     */
+    [[nodiscard]] std::string_view view() const noexcept {
+
+#if defined HAVE_FORMAT
+      return format.get();
+#else
+      const fmt::string_view text( format );
+      return { text.data(), text.size() };
+#endif
+    }
+
+    /**
+     * @brief Format string.
+     */
+    FormatString<Arguments...> format;
+
+    /**
+     * @brief Source location information.
+     */
+    CallSite location;
+  };
+
+  /**
+   * @brief Format string with arguments, that are deduced only from the call.
+   */
+  template<typename... Arguments>
+  using Format = FormatLocation<FormatIdentity<Arguments>...>;
+
+  /**
+   * @brief Collect arguments for formatTo().
+   * @param _arguments   Arguments to format.
+   * @return Type erased arguments, only valid until the end of the full expression.
+   */
+  template<typename... Arguments>
+  auto makeFormatArguments( const Arguments &..._arguments ) {
+
+#if defined HAVE_FORMAT
+    return std::make_format_args( _arguments... );
+#else
+    return fmt::make_format_args( _arguments... );
+#endif
+  }
+
+  /**
+   * @brief Reusable buffer of the calling thread for formatting messages.
+   * @return Buffer of the calling thread.
+   */
+  std::string &formatBuffer() noexcept;
+
+  /**
+   * @brief Append the formatted text.
+   * A format string, that does not match the arguments, is appended as it is.
+   * @param _output   Text is appended here.
+   * @param _format   Format string.
+   * @param _arguments   Type erased arguments.
+   */
+  void formatTo( std::string &_output,
+                 std::string_view _format,
+                 FormatArguments _arguments );
+
+  /**
+   * @brief Format the message into the buffer of the calling thread.
+   * @param _format   Checked format string.
+   * @param _arguments   Arguments to format.
+   * @return View on the buffer of the calling thread, valid until the next call.
+   */
+  template<typename... Arguments>
+  std::string_view formatMessage( FormatString<Arguments...> _format,
+                                  Arguments &&..._arguments ) {
+
+    std::string &buffer = formatBuffer();
+    buffer.clear();
+#if defined HAVE_FORMAT
+    std::format_to( std::back_inserter( buffer ), _format, std::forward<Arguments>( _arguments )... );
+#else
+    fmt::format_to( std::back_inserter( buffer ), _format, std::forward<Arguments>( _arguments )... );
+#endif
+    return buffer;
+  }
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* stl header */
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <utility>
+
+/* local header */
+#include "GroupFileWriter.h"
+
+namespace vx {
+
+  /**
+   * @brief Records per writev, below IOV_MAX of all POSIX systems.
+   */
+  constexpr std::size_t groupVectorSize = 256;
+
+  GroupFileWriter::GroupFileWriter( FileWriterSettings _settings,
+                                    bool _sync ) noexcept
+      : DescriptorFileWriter( std::move( _settings ) ),
+        m_sync( _sync ) {}
+
+  void GroupFileWriter::write( std::string_view _text,
+                               Severity _severity ) noexcept {
+
+    static_cast<void>( _severity );
+    try {
+
+      GroupRequest request { _text };
+      std::unique_lock<std::mutex> lock( m_mutex );
+      m_queue.push_back( &request );
+      while ( !request.done ) {
+
+        if ( m_writing ) {
+
+          /* the leader writes the record or the next leader */
+          m_condition.wait( lock );
+          continue;
+        }
+
+        /* the first thread without a running write becomes the leader and takes all posted records */
+        m_writing = true;
+        m_group.swap( m_queue );
+        lock.unlock();
+        writeGroup();
+        lock.lock();
+        for ( GroupRequest *written : m_group ) {
+
+          written->done = true;
+        }
+        m_group.clear();
+        m_writing = false;
+        m_condition.notify_all();
+      }
+    }
+    catch ( const std::exception &_exception ) {
+
+      /* the record could not be posted, write it alone */
+      std::cout << _exception.what() << std::endl;
+      const std::array<std::string_view, 1> parts = { _text };
+      writeDescriptor( parts, m_sync );
+    }
+  }
+
+  void GroupFileWriter::writeGroup() noexcept {
+
+    std::array<std::string_view, groupVectorSize> parts {};
+    for ( std::size_t offset = 0; offset < m_group.size(); offset += parts.size() ) {
+
+      const std::size_t count = std::min( parts.size(), m_group.size() - offset );
+      for ( std::size_t index = 0; index < count; ++index ) {
+
+        parts[ index ] = m_group[ offset + index ]->text;
+      }
+      /* the group is on the disk with the sync after its last records */
+      writeDescriptor( std::span( parts.data(), count ), m_sync && offset + count == m_group.size() );
+    }
+  }
+}
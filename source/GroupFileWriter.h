@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+/* stl header */
+#include <condition_variable>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+/* local header */
+#include "DescriptorFileWriter.h"
+
+/**
+ * @brief vx (VX APPS) namespace.
+ */
+namespace vx {
+
+  /**
+   * @brief The GroupFileWriter class - every record is in the file, when write returns (mode group).
+   * The first thread becomes the leader and writes its record and the records, that other threads posted meanwhile,
+   * with one writev, the others wait for it. With sync every group is also written to the disk with fdatasync.
+   * @author Florian Becker <fb\@vxapps.com> (VX APPS)
+   */
+  class GroupFileWriter : public DescriptorFileWriter {
+
+  public:
+    /**
+     * @brief Constructor for GroupFileWriter.
+     * @param _settings   Flush policy, only the filename is used.
+     * @param _sync   Write every group to the disk with fdatasync.
+     */
+    GroupFileWriter( FileWriterSettings _settings,
+                     bool _sync ) noexcept;
+
+    /**
+     * @brief Post the text and wait, until it is written by the leader or by the calling thread itself.
+     * @param _text   Text to write.
+     * @param _severity   Severity level of the text, every record is written at once.
+     */
+    void write( std::string_view _text,
+                Severity _severity ) noexcept override;
+
+    /**
+     * @brief Nothing to do, every record is written, before write returns.
+     */
+    void flush() noexcept override {}
+
+    /**
+     * @brief Nothing to do, nothing is buffered.
+     * @param _now   Current time.
+     */
+    void flushExpired( std::chrono::steady_clock::time_point _now ) noexcept override { static_cast<void>( _now ); }
+
+  private:
+    /**
+     * @brief The GroupRequest struct - record of a waiting thread, lives on its stack.
+     */
+    struct GroupRequest {
+
+      /**
+       * @brief Record to write.
+       */
+      std::string_view text {};
+
+      /**
+       * @brief The record is written, guarded by m_mutex.
+       */
+      bool done = false;
+    };
+
+    /**
+     * @brief Write the records of the group with one writev, only called by the leader.
+     */
+    void writeGroup() noexcept;
+
+    /**
+     * @brief Write every group to the disk with fdatasync.
+     */
+    bool m_sync = false;
+
+    /**
+     * @brief Records posted, guarded by m_mutex.
+     */
+    std::vector<GroupRequest *> m_queue {};
+
+    /**
+     * @brief Records the leader writes, only used by the leader.
+     */
+    std::vector<GroupRequest *> m_group {};
+
+    /**
+     * @brief A leader writes, guarded by m_mutex.
+     */
+    bool m_writing = false;
+
+    /**
+     * @brief Mutex of the posted records.
+     */
+    std::mutex m_mutex {};
+
+    /**
+     * @brief Condition for the waiting threads.
+     */
+    std::condition_variable m_condition {};
+  };
+}
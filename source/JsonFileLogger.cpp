@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2020 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* stl header */
+#include <string_view>
+
+/* local header */
+#include "JsonFileLogger.h"
+#include "Escape.h"
+#include "SeverityLabel.h"
+#include "TimestampCache.h"
+
+namespace vx {
+
+  /**
+   * @brief Reserved overhead for new json log entry.
+   */
+  constexpr int jsonOverhead = 256;
+
+  /**
+   * @brief Constant fragments between the values, the keys are never rendered per record.
+   */
+  namespace json {
+
+    /** Start of the object up to the timestamp */
+    constexpr std::string_view timestamp = "{\"timestamp\":\"";
+
+    /** End of the timestamp up to the severity */
+    constexpr std::string_view severity = "\",\"severity\":\"";
+
+    /** End of the severity up to the file */
+    constexpr std::string_view file = "\",\"file\":\"";
+
+    /** End of the file up to the line number */
+    constexpr std::string_view line = "\",\"line\":";
+
+    /** End of the line number up to the function */
+    constexpr std::string_view function = ",\"function\":\"";
+
+    /** End of the severity or the function up to the message */
+    constexpr std::string_view message = "\",\"message\":\"";
+
+    /** End of the message and of the object */
+    constexpr std::string_view end = "\"}\n";
+  }
+
+  JsonFileLogger::JsonFileLogger( const std::unordered_map<std::string, std::string> &_configuration )
+      : FileLogger( _configuration ) {}
+
+  void JsonFileLogger::log( const LogRecord &_record ) noexcept {
+
+    const std::string_view message = Logger::message( _record );
+    std::string output {};
+    output.reserve( message.size() + jsonOverhead );
+    output.append( json::timestamp );
+    TimestampCache::local().append( output, precision(), _record.timeOrNow() );
+    output.append( json::severity );
+    output.append( severityName( _record.severity ) );
+    if ( _record.location && _record.location->supported() ) {
+
+      output.append( json::file );
+      escape::appendJson( output, _record.location->file_name() );
+      output.append( json::line );
+      output.append( _record.location->lineText() );
+      output.append( json::function );
+      escape::appendJson( output, _record.location->function_name() );
+    }
+
+    output.append( json::message );
+    escape::appendJson( output, message );
+    output.append( json::end );
+
+    write( output, _record.severity );
+  }
+
+  void JsonFileLogger::log( std::string_view _message ) noexcept {
+
+    /* the text is no json, it becomes the message of an object without a severity */
+    if ( _message.ends_with( '\n' ) ) {
+
+      _message.remove_suffix( 1 );
+    }
+    std::string output {};
+    output.reserve( _message.size() + jsonOverhead );
+    output.append( json::timestamp );
+    TimestampCache::local().append( output, precision() );
+    output.append( json::message );
+    escape::appendJson( output, _message );
+    output.append( json::end );
+
+    write( output, Severity::Verbose );
+  }
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2020 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+/* stl header */
+#include <string>
+#include <unordered_map>
+
+/* local header */
+#include "FileLogger.h"
+
+/**
+ * @brief vx (VX APPS) namespace.
+ */
+namespace vx {
+
+  /**
+   * @brief The JsonFileLogger class for writing one JSON object per line (JSON Lines) to file.
+   * Every object has the keys timestamp, severity, file, line, function and message,
+   * file, line and function only with a known location. An already built message only has timestamp and message.
+   * @author Florian Becker <fb\@vxapps.com> (VX APPS)
+   */
+  class JsonFileLogger : public FileLogger {
+
+  public:
+    /**
+     * @brief Deletet default constructor for JsonFileLogger.
+     */
+    JsonFileLogger() = delete;
+
+    /**
+     * @brief Default constructor for JsonFileLogger.
+     * @param _configuration   Logger configuration.
+     */
+    explicit JsonFileLogger( const std::unordered_map<std::string, std::string> &_configuration ) noexcept( false );
+
+    using Logger::log;
+
+    /**
+     * @brief Render the record and write it.
+     * @param _record   Record to log.
+     */
+    void log( const LogRecord &_record ) noexcept override;
+
+    /**
+     * @brief Write an already built message as object with timestamp and message.
+     * @param _message   Message to log.
+     */
+    void log( std::string_view _message ) noexcept override;
+  };
+}
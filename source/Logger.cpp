@@ -28,16 +28,143 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+/* stl header */
+#include <algorithm>
+#include <cctype>
+#include <iostream>
+#include <stdexcept>
+
+/* magic enum */
+#include <magic_enum.hpp>
+
 /* local header */
 #include "Logger.h"
+#include "LoggerFactory.h"
 
 namespace vx {
 
-  Logger::Logger( [[maybe_unused]] const std::unordered_map<std::string, std::string> &_configuration ) noexcept {}
+  /**
+   * @brief Compare characters case insensitive.
+   * @param _lhs   Left character.
+   * @param _rhs   Right character.
+   * @return True, if both are equal, ignoring the case.
+   */
+  static bool equalsIgnoreCase( char _lhs,
+                                char _rhs ) noexcept {
+
+    return std::tolower( static_cast<unsigned char>( _lhs ) ) == std::tolower( static_cast<unsigned char>( _rhs ) );
+  }
+
+  std::optional<Severity> severityFromName( std::string_view _name ) noexcept {
+
+    return magic_enum::enum_cast<Severity>( _name, equalsIgnoreCase );
+  }
+
+  std::size_t configuredValue( const std::unordered_map<std::string, std::string> &_configuration,
+                               const std::string &_key,
+                               std::size_t _default ) {
+
+    const auto value = _configuration.find( _key );
+    if ( value == _configuration.end() ) {
+
+      return _default;
+    }
+
+    try {
+
+      return std::stoul( value->second );
+    }
+    catch ( const std::invalid_argument &_exception ) {
+
+      std::cout << _exception.what() << std::endl;
+      throw std::invalid_argument( value->second + " is not a valid " + _key + "." );
+    }
+    catch ( const std::out_of_range &_exception ) {
+
+      std::cout << _exception.what() << std::endl;
+      throw std::out_of_range( value->second + " is out of range " + _key + "." );
+    }
+  }
+
+  Logger::Logger( const std::unordered_map<std::string, std::string> &_configuration ) noexcept {
+
+    /* grab the timestamp precision */
+    if ( const auto precision = _configuration.find( "precision" ); precision != _configuration.end() ) {
+
+      if ( const auto value = magic_enum::enum_cast<timestamp::Precision>( precision->second, equalsIgnoreCase ) ) {
+
+        m_precision = *value;
+      }
+      else {
+
+        std::cout << precision->second << " is not a valid precision." << std::endl;
+      }
+    }
+
+    /* grab the runtime severity threshold */
+    const auto severity = _configuration.find( "severity" );
+    if ( severity == _configuration.end() ) {
 
-  void Logger::log( [[maybe_unused]] std::string_view _message,
-                    [[maybe_unused]] Severity _severity,
-                    [[maybe_unused]] const std::source_location &_location ) noexcept { /* /dev/null logger */ }
+      return;
+    }
+
+    const auto value = severityFromName( severity->second );
+    if ( !value ) {
+
+      std::cout << severity->second << " is not a valid severity." << std::endl;
+      return;
+    }
+    m_severity.store( std::max( *value, avoidLogBelow ), std::memory_order_relaxed );
+  }
+
+  void Logger::log( std::string_view _message,
+                    Severity _severity,
+                    const CallSite &_location ) noexcept {
+
+    if ( !accepts( _severity ) ) {
+
+      return;
+    }
+
+    /* a synchronous sink reads the clock, when it renders the record */
+    log( LogRecord { _severity, {}, &_location, _message, nullptr, std::this_thread::get_id() } );
+  }
+
+  void Logger::log( [[maybe_unused]] const LogRecord &_record ) noexcept { /* /dev/null logger */ }
 
   void Logger::log( [[maybe_unused]] std::string_view _message ) noexcept { /* /dev/null logger */ }
+
+  void Logger::logDeferred( const DeferredMessage &_message,
+                            Severity _severity,
+                            const CallSite &_location ) noexcept {
+
+    if ( !accepts( _severity ) ) {
+
+      return;
+    }
+
+    log( LogRecord { _severity, {}, &_location, {}, &_message, std::this_thread::get_id() } );
+  }
+
+  std::string_view Logger::message( const LogRecord &_record ) noexcept {
+
+    if ( !_record.deferred ) {
+
+      return _record.message;
+    }
+
+    std::string &message = formatBuffer();
+    message.clear();
+    _record.deferred->render( message );
+    return message;
+  }
+
+  void Logger::flush() noexcept { /* /dev/null logger */ }
+
+  void Logger::setSeverity( Severity _severity ) noexcept {
+
+    m_severity.store( std::max( _severity, avoidLogBelow ), std::memory_order_relaxed );
+    /* the pre-check of the global logger follows */
+    mirrorSeverity( *this );
+  }
 }
@@ -31,13 +31,24 @@
 #pragma once
 
 /* stl header */
+#include <atomic>
+#include <chrono>
 #include <iterator>
-#include <source_location.hpp>
+#include <optional>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
+/* modern.cpp.core */
+#include <Timestamp.h>
+
+/* local header */
+#include "CallSite.h"
+#include "DeferredMessage.h"
+
 /**
  * @brief vx (VX APPS) namespace.
  */
@@ -73,12 +84,76 @@ namespace vx {
   constexpr Severity avoidLogBelow = Severity::Fatal;
 #elif defined( LOGGINGNONE )
   /** Avoid log below fatal + 1. */
-  constexpr Severity avoidLogBelow = Severity::Fatal + 1;
+  constexpr Severity avoidLogBelow = static_cast<Severity>( static_cast<int>( Severity::Fatal ) + 1 );
 #else
   /** Avoid log below info. */
   constexpr Severity avoidLogBelow = Severity::Info;
 #endif
 
+  /**
+   * @brief The LogRecord struct - typed fields of one record, handed to the output stage.
+   * Sinks route, filter and render by these fields, instead of parsing the rendered text.
+   * The record only refers to the message and the location, it is valid during the call.
+   */
+  struct LogRecord {
+
+    /**
+     * @brief Severity level of the record.
+     */
+    Severity severity = Severity::Info;
+
+    /**
+     * @brief Time, when the record was logged, empty if it is logged right now.
+     */
+    std::chrono::system_clock::time_point time {};
+
+    /**
+     * @brief Source location information, nullptr if unknown.
+     */
+    const CallSite *location = nullptr;
+
+    /**
+     * @brief Message, empty if the record is deferred.
+     */
+    std::string_view message {};
+
+    /**
+     * @brief Format string and captured arguments, nullptr if the message is already rendered.
+     */
+    const DeferredMessage *deferred = nullptr;
+
+    /**
+     * @brief Thread, that logged the record.
+     */
+    std::thread::id thread {};
+
+    /**
+     * @brief Time of the record, the clock is only read, if the record is logged right now.
+     * @return The time.
+     */
+    [[nodiscard]] std::chrono::system_clock::time_point timeOrNow() const noexcept { return time == std::chrono::system_clock::time_point {} ? std::chrono::system_clock::now() : time; }
+  };
+
+  /**
+   * @brief Read a numeric configuration value.
+   * @param _configuration   Logger configuration.
+   * @param _key   Configuration key.
+   * @param _default   Value, if the key is missing.
+   * @return The configured value.
+   * @exception std::invalid_argument   If the value is not a number.
+   * @exception std::out_of_range   If the value is out of range.
+   */
+  [[nodiscard]] std::size_t configuredValue( const std::unordered_map<std::string, std::string> &_configuration,
+                                             const std::string &_key,
+                                             std::size_t _default ) noexcept( false );
+
+  /**
+   * @brief Severity of a configuration value, the case is ignored.
+   * @param _name   Name like info or INFO.
+   * @return The severity or nothing, if the name is unknown.
+   */
+  [[nodiscard]] std::optional<Severity> severityFromName( std::string_view _name ) noexcept;
+
   /**
    * @brief The Logger class.
    * @note Not pure virtual to use as /dev/null logger.
@@ -98,25 +173,111 @@ namespace vx {
      */
     explicit Logger( const std::unordered_map<std::string, std::string> &_configuration ) noexcept;
 
+    /**
+     * @brief Deleted copy constructor.
+     */
+    Logger( const Logger & ) = delete;
+
+    /**
+     * @brief Deleted move constructor.
+     */
+    Logger( Logger && ) = delete;
+
     /**
      * @brief Default destructor for Logger.
      */
     virtual ~Logger() = default;
 
     /**
-     * @brief Build the log message.
+     * @brief Deleted copy assign operator.
+     */
+    Logger &operator=( const Logger & ) = delete;
+
+    /**
+     * @brief Deleted move assign operator.
+     */
+    Logger &operator=( Logger && ) = delete;
+
+    /**
+     * @brief Build the record and hand it to the output stage.
      * @param _message   Message to log.
      * @param _severity   Severity level of the message.
      * @param _location   Source location information.
      */
     virtual void log( std::string_view _message,
                       Severity _severity,
-                      const std::source_location &_location = std::source_location::current() ) noexcept;
+                      const CallSite &_location = std::source_location::current() ) noexcept;
+
+    /**
+     * @brief Output stage, render and write the record.
+     * @param _record   Record to log, already accepted.
+     */
+    virtual void log( const LogRecord &_record ) noexcept;
 
     /**
      * @brief Output the log message.
      * @param _message   Message to log.
      */
     virtual void log( std::string_view _message ) noexcept;
+
+    /**
+     * @brief Build the record from captured arguments and hand it to the output stage.
+     * @param _message   Format string and captured arguments.
+     * @param _severity   Severity level of the message.
+     * @param _location   Source location information.
+     */
+    virtual void logDeferred( const DeferredMessage &_message,
+                              Severity _severity,
+                              const CallSite &_location ) noexcept;
+
+    /**
+     * @brief Write all buffered messages.
+     */
+    virtual void flush() noexcept;
+
+    /**
+     * @brief Change the runtime severity threshold.
+     * @param _severity   Lowest severity to log, never below avoidLogBelow.
+     */
+    virtual void setSeverity( Severity _severity ) noexcept;
+
+    /**
+     * @brief Current runtime severity threshold.
+     * @return Lowest severity to log.
+     */
+    [[nodiscard]] Severity severity() const noexcept { return m_severity.load( std::memory_order_relaxed ); }
+
+    /**
+     * @brief Check the runtime severity threshold, before any message is built.
+     * The threshold never falls below avoidLogBelow, so one compare covers both.
+     * @param _severity   Severity level of the message.
+     * @return True, if the message will be logged.
+     */
+    [[nodiscard]] bool accepts( Severity _severity ) const noexcept { return m_severity.load( std::memory_order_relaxed ) <= _severity; }
+
+    /**
+     * @brief Precision of the timestamps, configured with precision (seconds, milliseconds, microseconds or nanoseconds).
+     * @return Precision of the fraction of the second.
+     */
+    [[nodiscard]] timestamp::Precision precision() const noexcept { return m_precision; }
+
+  protected:
+    /**
+     * @brief Message of the record, a deferred record is rendered to the format buffer of the calling thread.
+     * @param _record   Record to log.
+     * @return The message, valid until the next call on this thread.
+     */
+    [[nodiscard]] static std::string_view message( const LogRecord &_record ) noexcept;
+
+  private:
+    /**
+     * @brief Runtime severity threshold.
+     */
+    std::atomic<Severity> m_severity { avoidLogBelow };
+
+    /**
+     * @brief Precision of the timestamps.
+     */
+    timestamp::Precision m_precision = timestamp::Precision::MicroSeconds;
   };
 }
@@ -33,11 +33,16 @@
 #if defined __GNUC__ && __GNUC__ >= 10 || defined _MSC_VER && _MSC_VER >= 1929
   #include <ranges>
 #endif
+#include <mutex>
 #include <stdexcept>
 
 /* local header */
+#include "AsyncLogger.h"
+#include "BinaryFileLogger.h"
 #include "FileLogger.h"
+#include "JsonFileLogger.h"
 #include "LoggerFactory.h"
+#include "MmapFileLogger.h"
 #include "StdLogger.h"
 #include "XmlFileLogger.h"
 
@@ -51,6 +56,12 @@ namespace vx {
       m_creators.try_emplace( "std", []( const std::unordered_map<std::string, std::string> &_configuration ) -> std::unique_ptr<Logger> { return std::make_unique<StdLogger>( _configuration ); } );
       m_creators.try_emplace( "file", []( const std::unordered_map<std::string, std::string> &_configuration ) -> std::unique_ptr<Logger> { return std::make_unique<FileLogger>( _configuration ); } );
       m_creators.try_emplace( "xml", []( const std::unordered_map<std::string, std::string> &_configuration ) -> std::unique_ptr<Logger> { return std::make_unique<XmlFileLogger>( _configuration ); } );
+      m_creators.try_emplace( "json", []( const std::unordered_map<std::string, std::string> &_configuration ) -> std::unique_ptr<Logger> { return std::make_unique<JsonFileLogger>( _configuration ); } );
+      m_creators.try_emplace( "binary", []( const std::unordered_map<std::string, std::string> &_configuration ) -> std::unique_ptr<Logger> { return std::make_unique<BinaryFileLogger>( _configuration ); } );
+#if defined __unix__ || defined __APPLE__
+      m_creators.try_emplace( "mmap", []( const std::unordered_map<std::string, std::string> &_configuration ) -> std::unique_ptr<Logger> { return std::make_unique<MmapFileLogger>( _configuration ); } );
+#endif
+      m_creators.try_emplace( "async", []( const std::unordered_map<std::string, std::string> &_configuration ) -> std::unique_ptr<Logger> { return std::make_unique<AsyncLogger>( _configuration ); } );
     }
     catch ( const std::bad_alloc &_exception ) {
 
@@ -85,4 +96,154 @@ namespace vx {
     /* couldn't get a logger */
     throw std::invalid_argument( "Couldn't produce logger of type: " + type->second );
   }
+
+  /**
+   * @brief The GlobalLoggerOwner class - destroys the global logger at exit.
+   */
+  class GlobalLoggerOwner {
+
+  public:
+    /**
+     * @brief Default constructor for GlobalLoggerOwner.
+     */
+    GlobalLoggerOwner() = default;
+
+    /**
+     * @brief Deleted copy constructor.
+     */
+    GlobalLoggerOwner( const GlobalLoggerOwner & ) = delete;
+
+    /**
+     * @brief Deleted move constructor.
+     */
+    GlobalLoggerOwner( GlobalLoggerOwner && ) = delete;
+
+    /**
+     * @brief Destructor for GlobalLoggerOwner - flushes and closes the global logger.
+     */
+    ~GlobalLoggerOwner() {
+
+      /* a logger installed later on is leaked on purpose */
+      const std::unique_ptr<Logger> instance( globalLogger.exchange( nullptr, std::memory_order_seq_cst ) );
+      loggerEpochs().synchronize();
+    }
+
+    /**
+     * @brief Deleted copy assign operator.
+     */
+    GlobalLoggerOwner &operator=( const GlobalLoggerOwner & ) = delete;
+
+    /**
+     * @brief Deleted move assign operator.
+     */
+    GlobalLoggerOwner &operator=( GlobalLoggerOwner && ) = delete;
+
+    /**
+     * @brief Mutex for creating the global logger only once.
+     */
+    std::mutex mutex {};
+
+    /**
+     * @brief Mutex, that keeps globalSeverity in line with the published global logger.
+     */
+    std::mutex severityMutex {};
+  };
+
+  EpochDomain &loggerEpochs() noexcept {
+
+#ifdef __clang__
+  #pragma clang diagnostic push
+  #pragma clang diagnostic ignored "-Wexit-time-destructors"
+#endif
+    static EpochDomain epochs {};
+#ifdef __clang__
+  #pragma clang diagnostic pop
+#endif
+    return epochs;
+  }
+
+  /**
+   * @brief Owner of the global logger.
+   * @return The owner.
+   */
+  static GlobalLoggerOwner &globalLoggerOwner() noexcept {
+
+    /* the epoch domain and the call sites have to outlive the owner */
+    static_cast<void>( loggerEpochs() );
+    static_cast<void>( CallSiteRegistry::instance() );
+
+#ifdef __clang__
+  #pragma clang diagnostic push
+  #pragma clang diagnostic ignored "-Wexit-time-destructors"
+#endif
+    static GlobalLoggerOwner owner {};
+#ifdef __clang__
+  #pragma clang diagnostic pop
+#endif
+    return owner;
+  }
+
+  /**
+   * @brief Create a logger, fall back to the /dev/null logger.
+   * @param _configuration   Configuration for logger.
+   * @return The logger.
+   */
+  static std::unique_ptr<Logger> createLogger( const std::unordered_map<std::string, std::string> &_configuration ) noexcept {
+
+    try {
+
+      return LoggerFactory::instance().produce( _configuration );
+    }
+    catch ( [[maybe_unused]] const std::exception &_exception ) {
+
+      /* Could not create a real logger */
+      std::cout << "Cannot create a real logger: " << _exception.what() << std::endl;
+    }
+    return std::make_unique<Logger>( _configuration );
+  }
+
+  Logger &installLogger( const std::unordered_map<std::string, std::string> &_configuration ) noexcept {
+
+    GlobalLoggerOwner &owner = globalLoggerOwner();
+    const std::lock_guard<std::mutex> lock( owner.mutex );
+    if ( Logger *instance = globalLogger.load( std::memory_order_acquire ) ) {
+
+      return *instance;
+    }
+
+    std::unique_ptr<Logger> instance = createLogger( _configuration );
+    {
+      const std::lock_guard<std::mutex> severityLock( owner.severityMutex );
+      globalSeverity.store( instance->severity(), std::memory_order_relaxed );
+      globalLogger.store( instance.get(), std::memory_order_seq_cst );
+    }
+    return *instance.release();
+  }
+
+  void replaceLogger( const std::unordered_map<std::string, std::string> &_configuration ) noexcept {
+
+    GlobalLoggerOwner &owner = globalLoggerOwner();
+    const std::lock_guard<std::mutex> lock( owner.mutex );
+
+    std::unique_ptr<Logger> instance = createLogger( _configuration );
+    std::unique_ptr<Logger> previous {};
+    {
+      const std::lock_guard<std::mutex> severityLock( owner.severityMutex );
+      globalSeverity.store( instance->severity(), std::memory_order_relaxed );
+      previous.reset( globalLogger.exchange( instance.release(), std::memory_order_seq_cst ) );
+    }
+
+    /* callers might still log to the previous logger */
+    loggerEpochs().synchronize();
+  }
+
+  void mirrorSeverity( const Logger &_logger ) noexcept {
+
+    GlobalLoggerOwner &owner = globalLoggerOwner();
+    const std::lock_guard<std::mutex> lock( owner.severityMutex );
+    if ( globalLogger.load( std::memory_order_acquire ) == &_logger ) {
+
+      globalSeverity.store( _logger.severity(), std::memory_order_relaxed );
+    }
+  }
 }
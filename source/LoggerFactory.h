@@ -31,15 +31,22 @@
 #pragma once
 
 /* stl header */
+#include <atomic>
 #include <iostream>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <unordered_map>
+#include <utility>
 
 /* modern.cpp.core */
 #include <Singleton.h>
 
 /* local header */
+#include "CallSiteRegistry.h"
+#include "EpochDomain.h"
+#include "Format.h"
 #include "Logger.h"
 
 /**
@@ -74,30 +81,64 @@ namespace vx {
   };
 
   /**
-   * @brief Create instance with default configuration for logger.
+   * @brief Runtime severity threshold of the global logger, mirrored to check it before the logger is resolved.
+   * Logger::setSeverity of the installed logger updates it.
+   */
+  inline std::atomic<Severity> globalSeverity { avoidLogBelow };
+
+  /**
+   * @brief Global logger, resolved once and afterwards only loaded.
+   */
+  inline std::atomic<Logger *> globalLogger { nullptr };
+
+  /**
+   * @brief Epoch domain, that keeps a replaced global logger alive while it is still in use.
+   * @return The epoch domain of the global logger.
+   */
+  EpochDomain &loggerEpochs() noexcept;
+
+  /**
+   * @brief Create and install the global logger, if there is none yet.
    * @param _configuration   Configuration for logger.
+   * @return The installed global logger.
    */
-  inline Logger &logger( const std::unordered_map<std::string, std::string> &_configuration = { { "type", "std" }, { "color", "" } } ) noexcept {
+  Logger &installLogger( const std::unordered_map<std::string, std::string> &_configuration ) noexcept;
 
-#ifdef __clang__
-  #pragma clang diagnostic push
-  #pragma clang diagnostic ignored "-Wexit-time-destructors"
-#endif
-    std::unique_ptr<Logger> logger {};
-    try {
+  /**
+   * @brief Copy the runtime severity threshold to globalSeverity, if the logger is the global logger.
+   * @param _logger   Logger with a changed threshold.
+   */
+  void mirrorSeverity( const Logger &_logger ) noexcept;
 
-      logger = LoggerFactory::instance().produce( _configuration );
-    }
-    catch ( [[maybe_unused]] const std::exception &_exception ) {
+  /**
+   * @brief Create and publish a new global logger, the former one is destroyed after all callers left it.
+   * Must not be called while holding an EpochGuard of loggerEpochs().
+   * @param _configuration   Configuration for logger.
+   */
+  void replaceLogger( const std::unordered_map<std::string, std::string> &_configuration ) noexcept;
+
+  /**
+   * @brief Global logger, created with default configuration on first use.
+   * @note The reference stays valid until the next ConfigureLogger(), hold an EpochGuard of loggerEpochs() while using it.
+   * @return The global logger.
+   */
+  inline Logger &logger() noexcept {
 
-      /* Could not create a real logger */
-      std::cout << "Cannot create a real logger: " << _exception.what() << std::endl;
+    if ( Logger *instance = globalLogger.load( std::memory_order_acquire ) ) {
+
+      return *instance;
     }
-    static std::unique_ptr<Logger> singleton( std::move( logger ) );
-    return *singleton;
-#ifdef __clang__
-  #pragma clang diagnostic pop
-#endif
+    return installLogger( { { "type", "std" }, { "color", "" } } );
+  }
+
+  /**
+   * @brief Create instance with configuration for logger, if there is none yet.
+   * @param _configuration   Configuration for logger.
+   * @return The global logger.
+   */
+  inline Logger &logger( const std::unordered_map<std::string, std::string> &_configuration ) noexcept {
+
+    return installLogger( _configuration );
   }
 
   /**
@@ -106,7 +147,62 @@ namespace vx {
    */
   inline void ConfigureLogger( const std::unordered_map<std::string, std::string> &_configuration ) noexcept {
 
-    logger( _configuration );
+    replaceLogger( _configuration );
+  }
+
+  /**
+   * @brief Change the runtime severity threshold of the global logger.
+   * @param _severity   Lowest severity to log, never below avoidLogBelow.
+   */
+  inline void SetLogSeverity( Severity _severity ) noexcept {
+
+    const EpochGuard guard( loggerEpochs() );
+    logger().setSeverity( _severity );
+  }
+
+  /**
+   * @brief Write all buffered messages of the global logger, e.g. before reading the log file.
+   */
+  inline void FlushLogger() noexcept {
+
+    const EpochGuard guard( loggerEpochs() );
+    logger().flush();
+  }
+
+  /**
+   * @brief Check the compile time and runtime severity threshold of the global logger.
+   * @param _severity   Severity level of the message.
+   * @return True, if the message will be logged.
+   */
+  inline bool IsLogEnabled( Severity _severity ) noexcept {
+
+    return avoidLogBelow <= _severity && globalSeverity.load( std::memory_order_relaxed ) <= _severity;
+  }
+
+  /**
+   * @brief Call site of the location, registered on first use.
+   * @param _location   Source location information.
+   * @param _format   Format string, empty for plain messages.
+   * @param _severity   Severity level of the call site.
+   * @return Location with the id of the call site.
+   */
+  inline const CallSite &registeredSite( const CallSite &_location,
+                                         std::string_view _format,
+                                         Severity _severity ) noexcept {
+
+    return CallSiteRegistry::instance().intern( _location, _format, _severity ).location;
+  }
+
+  /**
+   * @brief View on a string literal or a character array, without the terminating zero.
+   * @param _text   String literal.
+   * @return View on the text.
+   */
+  template<std::size_t Size>
+  constexpr std::string_view literalView( const char ( &_text )[ Size ] ) noexcept {
+
+    const char *end = std::char_traits<char>::find( _text, Size, '\0' );
+    return { _text, end ? static_cast<std::size_t>( end - _text ) : Size };
   }
 
   /**
@@ -115,31 +211,154 @@ namespace vx {
    * @param _severity   Severity level for message to log.
    * @param _location   Source location information.
    */
-  inline void Log( const std::string &_message,
+  inline void Log( std::string_view _message,
                    Severity _severity,
-                   const std::source_location &_location = std::source_location::current() ) noexcept {
+                   const CallSite &_location = std::source_location::current() ) noexcept {
+
+    if ( !IsLogEnabled( _severity ) ) {
 
-    logger().log( _message, _severity, _location );
+      return;
+    }
+    const EpochGuard guard( loggerEpochs() );
+    logger().log( _message, _severity, registeredSite( _location, {}, _severity ) );
+  }
+
+  /**
+   * @brief Direct function for logging a string literal.
+   * @param _message   Message to log.
+   * @param _severity   Severity level for message to log.
+   * @param _location   Source location information.
+   */
+  template<std::size_t Size>
+  inline void Log( const char ( &_message )[ Size ],
+                   Severity _severity,
+                   const CallSite &_location = std::source_location::current() ) noexcept {
+
+    Log( literalView( _message ), _severity, _location );
+  }
+
+  /**
+   * @brief Direct function for logging with a format string.
+   * Arithmetic and enum arguments are captured for deferred formatting, e.g. by the
+   * backend of the async logger. Other arguments are formatted right away into a
+   * buffer of the calling thread. Nothing is formatted, if the severity is filtered.
+   * @param _severity   Severity level for message to log.
+   * @param _format   Format string literal, checked against the arguments.
+   * @param _arguments   Arguments to format.
+   */
+  template<typename... Arguments>
+  inline void LogFormat( Severity _severity,
+                         Format<Arguments...> _format,
+                         Arguments &&..._arguments ) noexcept {
+
+    if ( !IsLogEnabled( _severity ) ) {
+
+      return;
+    }
+    const CallSite &location = registeredSite( _format.location, _format.view(), _severity );
+    const EpochGuard guard( loggerEpochs() );
+    if constexpr ( ( isDeferrable<std::decay_t<Arguments>> && ... ) && ( sizeof( std::decay_t<Arguments> ) + ... + 0 ) <= DeferredMessage::argumentCapacity ) {
+
+      logger().logDeferred( DeferredMessage( _format.view(), std::decay_t<Arguments>( _arguments )... ), _severity, location );
+    }
+    else {
+
+      logger().log( formatMessage( _format.format, std::forward<Arguments>( _arguments )... ), _severity, location );
+    }
+  }
+
+  /**
+   * @brief Direct function for logging with a lazily built message.
+   * The callable is only invoked, if the severity passes the compile time and runtime threshold.
+   * @param _severity   Severity level for message to log.
+   * @param _message   Callable returning the message.
+   * @param _location   Source location information.
+   */
+  template<typename Callable, std::enable_if_t<std::is_invocable_v<Callable>, int> = 0>
+  inline void LogLazy( Severity _severity,
+                       Callable &&_message,
+                       const CallSite &_location = std::source_location::current() ) noexcept {
+
+    if ( !IsLogEnabled( _severity ) ) {
+
+      return;
+    }
+    /* build the message outside of the epoch, it might log on its own */
+    const auto &message = std::forward<Callable>( _message )();
+    const EpochGuard guard( loggerEpochs() );
+    logger().log( message, _severity, registeredSite( _location, {}, _severity ) );
   }
 
   /**
    * @brief Direct function for logging.
    * @param _message   Message to log.
    */
-  inline void Log( const std::string &_message ) noexcept {
+  inline void Log( std::string_view _message ) noexcept {
 
+    const EpochGuard guard( loggerEpochs() );
     logger().log( _message );
   }
 
+  /**
+   * @brief Direct function for logging a string literal.
+   * @param _message   Message to log.
+   */
+  template<std::size_t Size>
+  inline void Log( const char ( &_message )[ Size ] ) noexcept {
+
+    Log( literalView( _message ) );
+  }
+
   /**
    * @brief Direct function for logging with verbose serivity.
    * @param _message   Message to log.
    * @param _location   Source location information.
    */
-  inline void LogVerbose( const std::string &_message,
-                          const std::source_location &_location = std::source_location::current() ) noexcept {
+  inline void LogVerbose( std::string_view _message,
+                          const CallSite &_location = std::source_location::current() ) noexcept {
+
+    if ( !IsLogEnabled( Severity::Verbose ) ) {
+
+      return;
+    }
+    const EpochGuard guard( loggerEpochs() );
+    logger().log( _message, Severity::Verbose, registeredSite( _location, {}, Severity::Verbose ) );
+  }
+
+  /**
+   * @brief Direct function for logging a string literal with verbose serivity.
+   * @param _message   Message to log.
+   * @param _location   Source location information.
+   */
+  template<std::size_t Size>
+  inline void LogVerbose( const char ( &_message )[ Size ],
+                         const CallSite &_location = std::source_location::current() ) noexcept {
+
+    LogVerbose( literalView( _message ), _location );
+  }
+
+  /**
+   * @brief Direct function for logging with verbose serivity and a lazily built message.
+   * @param _message   Callable returning the message, only invoked if the severity is logged.
+   * @param _location   Source location information.
+   */
+  template<typename Callable, std::enable_if_t<std::is_invocable_v<Callable>, int> = 0>
+  inline void LogVerbose( Callable &&_message,
+                         const CallSite &_location = std::source_location::current() ) noexcept {
+
+    LogLazy( Severity::Verbose, std::forward<Callable>( _message ), _location );
+  }
+
+  /**
+   * @brief Direct function for logging with verbose serivity and a format string.
+   * @param _format   Format string literal, checked against the arguments.
+   * @param _arguments   Arguments to format.
+   */
+  template<typename... Arguments>
+  inline void LogVerbose( Format<Arguments...> _format,
+                          Arguments &&..._arguments ) noexcept {
 
-    logger().log( _message, Severity::Verbose, _location );
+    LogFormat( Severity::Verbose, _format, std::forward<Arguments>( _arguments )... );
   }
 
   /**
@@ -147,10 +366,51 @@ namespace vx {
    * @param _message   Message to log.
    * @param _location   Source location information.
    */
-  inline void LogDebug( const std::string &_message,
-                        const std::source_location &_location = std::source_location::current() ) noexcept {
+  inline void LogDebug( std::string_view _message,
+                        const CallSite &_location = std::source_location::current() ) noexcept {
 
-    logger().log( _message, Severity::Debug, _location );
+    if ( !IsLogEnabled( Severity::Debug ) ) {
+
+      return;
+    }
+    const EpochGuard guard( loggerEpochs() );
+    logger().log( _message, Severity::Debug, registeredSite( _location, {}, Severity::Debug ) );
+  }
+
+  /**
+   * @brief Direct function for logging a string literal with debug serivity.
+   * @param _message   Message to log.
+   * @param _location   Source location information.
+   */
+  template<std::size_t Size>
+  inline void LogDebug( const char ( &_message )[ Size ],
+                       const CallSite &_location = std::source_location::current() ) noexcept {
+
+    LogDebug( literalView( _message ), _location );
+  }
+
+  /**
+   * @brief Direct function for logging with debug serivity and a lazily built message.
+   * @param _message   Callable returning the message, only invoked if the severity is logged.
+   * @param _location   Source location information.
+   */
+  template<typename Callable, std::enable_if_t<std::is_invocable_v<Callable>, int> = 0>
+  inline void LogDebug( Callable &&_message,
+                       const CallSite &_location = std::source_location::current() ) noexcept {
+
+    LogLazy( Severity::Debug, std::forward<Callable>( _message ), _location );
+  }
+
+  /**
+   * @brief Direct function for logging with debug serivity and a format string.
+   * @param _format   Format string literal, checked against the arguments.
+   * @param _arguments   Arguments to format.
+   */
+  template<typename... Arguments>
+  inline void LogDebug( Format<Arguments...> _format,
+                        Arguments &&..._arguments ) noexcept {
+
+    LogFormat( Severity::Debug, _format, std::forward<Arguments>( _arguments )... );
   }
 
   /**
@@ -158,10 +418,51 @@ namespace vx {
    * @param _message   Message to log.
    * @param _location   Source location information.
    */
-  inline void LogInfo( const std::string &_message,
-                       const std::source_location &_location = std::source_location::current() ) noexcept {
+  inline void LogInfo( std::string_view _message,
+                       const CallSite &_location = std::source_location::current() ) noexcept {
+
+    if ( !IsLogEnabled( Severity::Info ) ) {
 
-    logger().log( _message, Severity::Info, _location );
+      return;
+    }
+    const EpochGuard guard( loggerEpochs() );
+    logger().log( _message, Severity::Info, registeredSite( _location, {}, Severity::Info ) );
+  }
+
+  /**
+   * @brief Direct function for logging a string literal with info serivity.
+   * @param _message   Message to log.
+   * @param _location   Source location information.
+   */
+  template<std::size_t Size>
+  inline void LogInfo( const char ( &_message )[ Size ],
+                      const CallSite &_location = std::source_location::current() ) noexcept {
+
+    LogInfo( literalView( _message ), _location );
+  }
+
+  /**
+   * @brief Direct function for logging with info serivity and a lazily built message.
+   * @param _message   Callable returning the message, only invoked if the severity is logged.
+   * @param _location   Source location information.
+   */
+  template<typename Callable, std::enable_if_t<std::is_invocable_v<Callable>, int> = 0>
+  inline void LogInfo( Callable &&_message,
+                      const CallSite &_location = std::source_location::current() ) noexcept {
+
+    LogLazy( Severity::Info, std::forward<Callable>( _message ), _location );
+  }
+
+  /**
+   * @brief Direct function for logging with info serivity and a format string.
+   * @param _format   Format string literal, checked against the arguments.
+   * @param _arguments   Arguments to format.
+   */
+  template<typename... Arguments>
+  inline void LogInfo( Format<Arguments...> _format,
+                       Arguments &&..._arguments ) noexcept {
+
+    LogFormat( Severity::Info, _format, std::forward<Arguments>( _arguments )... );
   }
 
   /**
@@ -169,10 +470,51 @@ namespace vx {
    * @param _message   Message to log.
    * @param _location   Source location information.
    */
-  inline void LogWarning( const std::string &_message,
-                          const std::source_location &_location = std::source_location::current() ) noexcept {
+  inline void LogWarning( std::string_view _message,
+                          const CallSite &_location = std::source_location::current() ) noexcept {
+
+    if ( !IsLogEnabled( Severity::Warning ) ) {
+
+      return;
+    }
+    const EpochGuard guard( loggerEpochs() );
+    logger().log( _message, Severity::Warning, registeredSite( _location, {}, Severity::Warning ) );
+  }
+
+  /**
+   * @brief Direct function for logging a string literal with warning serivity.
+   * @param _message   Message to log.
+   * @param _location   Source location information.
+   */
+  template<std::size_t Size>
+  inline void LogWarning( const char ( &_message )[ Size ],
+                         const CallSite &_location = std::source_location::current() ) noexcept {
+
+    LogWarning( literalView( _message ), _location );
+  }
+
+  /**
+   * @brief Direct function for logging with warning serivity and a lazily built message.
+   * @param _message   Callable returning the message, only invoked if the severity is logged.
+   * @param _location   Source location information.
+   */
+  template<typename Callable, std::enable_if_t<std::is_invocable_v<Callable>, int> = 0>
+  inline void LogWarning( Callable &&_message,
+                         const CallSite &_location = std::source_location::current() ) noexcept {
 
-    logger().log( _message, Severity::Warning, _location );
+    LogLazy( Severity::Warning, std::forward<Callable>( _message ), _location );
+  }
+
+  /**
+   * @brief Direct function for logging with warning serivity and a format string.
+   * @param _format   Format string literal, checked against the arguments.
+   * @param _arguments   Arguments to format.
+   */
+  template<typename... Arguments>
+  inline void LogWarning( Format<Arguments...> _format,
+                          Arguments &&..._arguments ) noexcept {
+
+    LogFormat( Severity::Warning, _format, std::forward<Arguments>( _arguments )... );
   }
 
   /**
@@ -180,10 +522,51 @@ namespace vx {
    * @param _message   Message to log.
    * @param _location   Source location information.
    */
-  inline void LogError( const std::string &_message,
-                        const std::source_location &_location = std::source_location::current() ) noexcept {
+  inline void LogError( std::string_view _message,
+                        const CallSite &_location = std::source_location::current() ) noexcept {
+
+    if ( !IsLogEnabled( Severity::Error ) ) {
+
+      return;
+    }
+    const EpochGuard guard( loggerEpochs() );
+    logger().log( _message, Severity::Error, registeredSite( _location, {}, Severity::Error ) );
+  }
+
+  /**
+   * @brief Direct function for logging a string literal with error serivity.
+   * @param _message   Message to log.
+   * @param _location   Source location information.
+   */
+  template<std::size_t Size>
+  inline void LogError( const char ( &_message )[ Size ],
+                       const CallSite &_location = std::source_location::current() ) noexcept {
 
-    logger().log( _message, Severity::Error, _location );
+    LogError( literalView( _message ), _location );
+  }
+
+  /**
+   * @brief Direct function for logging with error serivity and a lazily built message.
+   * @param _message   Callable returning the message, only invoked if the severity is logged.
+   * @param _location   Source location information.
+   */
+  template<typename Callable, std::enable_if_t<std::is_invocable_v<Callable>, int> = 0>
+  inline void LogError( Callable &&_message,
+                       const CallSite &_location = std::source_location::current() ) noexcept {
+
+    LogLazy( Severity::Error, std::forward<Callable>( _message ), _location );
+  }
+
+  /**
+   * @brief Direct function for logging with error serivity and a format string.
+   * @param _format   Format string literal, checked against the arguments.
+   * @param _arguments   Arguments to format.
+   */
+  template<typename... Arguments>
+  inline void LogError( Format<Arguments...> _format,
+                        Arguments &&..._arguments ) noexcept {
+
+    LogFormat( Severity::Error, _format, std::forward<Arguments>( _arguments )... );
   }
 
   /**
@@ -191,9 +574,82 @@ namespace vx {
    * @param _message   Message to log.
    * @param _location   Source location information.
    */
-  inline void LogFatal( const std::string &_message,
-                        const std::source_location &_location = std::source_location::current() ) noexcept {
+  inline void LogFatal( std::string_view _message,
+                        const CallSite &_location = std::source_location::current() ) noexcept {
+
+    if ( !IsLogEnabled( Severity::Fatal ) ) {
+
+      return;
+    }
+    const EpochGuard guard( loggerEpochs() );
+    logger().log( _message, Severity::Fatal, registeredSite( _location, {}, Severity::Fatal ) );
+  }
+
+  /**
+   * @brief Direct function for logging a string literal with fatal error serivity.
+   * @param _message   Message to log.
+   * @param _location   Source location information.
+   */
+  template<std::size_t Size>
+  inline void LogFatal( const char ( &_message )[ Size ],
+                       const CallSite &_location = std::source_location::current() ) noexcept {
 
-    logger().log( _message, Severity::Fatal, _location );
+    LogFatal( literalView( _message ), _location );
+  }
+
+  /**
+   * @brief Direct function for logging with fatal error serivity and a lazily built message.
+   * @param _message   Callable returning the message, only invoked if the severity is logged.
+   * @param _location   Source location information.
+   */
+  template<typename Callable, std::enable_if_t<std::is_invocable_v<Callable>, int> = 0>
+  inline void LogFatal( Callable &&_message,
+                       const CallSite &_location = std::source_location::current() ) noexcept {
+
+    LogLazy( Severity::Fatal, std::forward<Callable>( _message ), _location );
+  }
+
+  /**
+   * @brief Direct function for logging with fatal error serivity and a format string.
+   * @param _format   Format string literal, checked against the arguments.
+   * @param _arguments   Arguments to format.
+   */
+  template<typename... Arguments>
+  inline void LogFatal( Format<Arguments...> _format,
+                        Arguments &&..._arguments ) noexcept {
+
+    LogFormat( Severity::Fatal, _format, std::forward<Arguments>( _arguments )... );
   }
 }
+
+/**
+ * @brief Log with a format string, the arguments are only evaluated if the severity is logged.
+ * Compiled away completely, if the severity is below avoidLogBelow.
+ * @param _severity   Severity level for message to log, known at compile time.
+ */
+#define VX_LOG( _severity, ... )                                  \
+  do {                                                            \
+    if constexpr ( ::vx::avoidLogBelow <= ( _severity ) ) {       \
+      if ( ::vx::IsLogEnabled( _severity ) ) {                    \
+        ::vx::LogFormat( _severity, __VA_ARGS__ );                \
+      }                                                           \
+    }                                                             \
+  } while ( false )
+
+/** Log with verbose severity, see VX_LOG. */
+#define VX_LOG_VERBOSE( ... ) VX_LOG( ::vx::Severity::Verbose, __VA_ARGS__ )
+
+/** Log with debug severity, see VX_LOG. */
+#define VX_LOG_DEBUG( ... ) VX_LOG( ::vx::Severity::Debug, __VA_ARGS__ )
+
+/** Log with info severity, see VX_LOG. */
+#define VX_LOG_INFO( ... ) VX_LOG( ::vx::Severity::Info, __VA_ARGS__ )
+
+/** Log with warning severity, see VX_LOG. */
+#define VX_LOG_WARNING( ... ) VX_LOG( ::vx::Severity::Warning, __VA_ARGS__ )
+
+/** Log with error severity, see VX_LOG. */
+#define VX_LOG_ERROR( ... ) VX_LOG( ::vx::Severity::Error, __VA_ARGS__ )
+
+/** Log with fatal error severity, see VX_LOG. */
+#define VX_LOG_FATAL( ... ) VX_LOG( ::vx::Severity::Fatal, __VA_ARGS__ )
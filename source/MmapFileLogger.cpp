@@ -0,0 +1,366 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* system header */
+#if defined __unix__ || defined __APPLE__
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+/* stl header */
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+
+/* local header */
+#include "MmapFileLogger.h"
+
+#if defined __unix__ || defined __APPLE__
+namespace vx {
+
+  /**
+   * @brief Default size of a segment in bytes.
+   */
+  constexpr std::size_t segmentSize = 32 * 1024 * 1024;
+
+  /**
+   * @brief Keys of the file logger, that do not apply to segments.
+   */
+  constexpr std::array<std::string_view, 6> unsupportedKeys = { "max_size", "max_age", "max_files", "compression", "compression_mode", "compression_level" };
+
+  MmapFileLogger::MmapFileLogger( const std::unordered_map<std::string, std::string> &_configuration )
+    : FileLogger( _configuration, std::ofstream::out | std::ofstream::app, FileOutput::Derived ) {
+
+    m_segmentSize = configuredValue( _configuration, "segment_size", segmentSize );
+    if ( m_segmentSize == 0 ) {
+
+      throw std::invalid_argument( "Segment size of mmap logger cannot be zero." );
+    }
+
+    /* segments roll on their own, they are neither rotated nor compressed */
+    ignoreMode( _configuration, "mmap", "using the mapped segments" );
+    for ( const std::string_view key : unsupportedKeys ) {
+
+      if ( _configuration.contains( std::string( key ) ) ) {
+
+        std::cout << key << " is not supported by the mmap logger and is ignored." << std::endl;
+      }
+    }
+
+    /* without a segment the records are dropped, until the background thread created one */
+    m_active = createSegment( m_segmentSize );
+    m_segment.store( m_active.get(), std::memory_order_release );
+    m_lastRoll = std::chrono::steady_clock::now();
+
+    m_background = std::thread( &MmapFileLogger::run, this );
+  }
+
+  MmapFileLogger::~MmapFileLogger() noexcept {
+
+    {
+      const std::lock_guard<std::mutex> lock( m_mutex );
+      m_stop = true;
+    }
+    m_condition.notify_one();
+    if ( m_background.joinable() ) {
+
+      m_background.join();
+    }
+
+    /* no producer is left */
+    for ( auto &segment : m_retired ) {
+
+      closeSegment( *segment );
+    }
+    if ( m_active ) {
+
+      m_active->end = std::min( m_active->reserved.load( std::memory_order_acquire ), m_active->capacity );
+      closeSegment( *m_active );
+    }
+    if ( m_next ) {
+
+      /* the preallocated segment was never used */
+      closeSegment( *m_next );
+      if ( m_next->end == 0 && m_next->name != filename() ) {
+
+        ::unlink( m_next->name.c_str() );
+      }
+    }
+  }
+
+  void MmapFileLogger::flush() noexcept {
+
+    /* the mapping is already part of the page cache, readers of the file see every record */
+    const EpochGuard guard( m_epochs );
+    if ( const Segment *segment = m_segment.load( std::memory_order_acquire ) ) {
+
+      const std::size_t reserved = std::min( segment->reserved.load( std::memory_order_acquire ), segment->capacity );
+      ::msync( segment->mapping, reserved - segment->mapOffset, MS_ASYNC );
+    }
+  }
+
+  void MmapFileLogger::write( std::string_view _text,
+                              Severity _severity ) noexcept {
+
+    static_cast<void>( _severity );
+    if ( _text.empty() ) {
+
+      return;
+    }
+
+    const EpochGuard guard( m_epochs );
+    while ( Segment *segment = m_segment.load( std::memory_order_acquire ) ) {
+
+      const std::size_t offset = segment->reserved.fetch_add( _text.size(), std::memory_order_relaxed );
+      if ( offset + _text.size() <= segment->capacity ) {
+
+        std::memcpy( segment->mapping + ( offset - segment->mapOffset ), _text.data(), _text.size() );
+        return;
+      }
+
+      /* the record, that crosses the end, rolls the segment, all later ones wait for the next segment */
+      if ( offset <= segment->capacity ) {
+
+        roll( segment, offset, _text.size() );
+      }
+      else {
+
+        while ( m_segment.load( std::memory_order_acquire ) == segment ) {
+
+          std::this_thread::yield();
+        }
+      }
+    }
+  }
+
+  std::unique_ptr<MmapFileLogger::Segment> MmapFileLogger::createSegment( std::size_t _size ) noexcept {
+
+    try {
+
+      auto segment = std::make_unique<Segment>();
+      std::size_t index = 0;
+      do {
+
+        /* only the first segment appends to an existing file, later segments never overwrite one */
+        index = m_index.fetch_add( 1, std::memory_order_relaxed );
+        segment->name = index == 0 ? filename() : filename() + "." + std::to_string( index );
+        segment->descriptor = ::open( segment->name.c_str(), O_RDWR | O_CREAT | O_CLOEXEC | ( index == 0 ? 0 : O_EXCL ), 0644 );
+      } while ( segment->descriptor < 0 && errno == EEXIST );
+
+      const auto failed = [ &segment, &index ]( const char *_call ) {
+        std::cout << "Cannot " << _call << " " << segment->name << ": " << std::strerror( errno ) << std::endl;
+        if ( segment->descriptor >= 0 ) {
+
+          ::close( segment->descriptor );
+          if ( index > 0 ) {
+
+            ::unlink( segment->name.c_str() );
+          }
+        }
+        return nullptr;
+      };
+      if ( segment->descriptor < 0 ) {
+
+        return failed( "open" );
+      }
+
+      struct stat status {};
+      if ( ::fstat( segment->descriptor, &status ) != 0 ) {
+
+        return failed( "stat" );
+      }
+      const auto existing = static_cast<std::size_t>( status.st_size );
+      const auto page = static_cast<std::size_t>( ::sysconf( _SC_PAGESIZE ) );
+      segment->mapOffset = existing - existing % page;
+      segment->capacity = existing + _size;
+      segment->reserved.store( existing, std::memory_order_relaxed );
+      segment->end = existing;
+
+      /* reserve the blocks now, so copying a record never runs out of space */
+#ifdef __linux__
+      if ( ::fallocate( segment->descriptor, 0, 0, static_cast<off_t>( segment->capacity ) ) != 0 && ( errno != EOPNOTSUPP || ::ftruncate( segment->descriptor, static_cast<off_t>( segment->capacity ) ) != 0 ) ) {
+#else
+      if ( ::ftruncate( segment->descriptor, static_cast<off_t>( segment->capacity ) ) != 0 ) {
+#endif
+
+        return failed( "preallocate" );
+      }
+
+      int flags = MAP_SHARED;
+#ifdef MAP_POPULATE
+      /* fault the pages in here and not on the producers */
+      flags |= MAP_POPULATE;
+#endif
+      void *mapping = ::mmap( nullptr, segment->capacity - segment->mapOffset, PROT_READ | PROT_WRITE, flags, segment->descriptor, static_cast<off_t>( segment->mapOffset ) );
+      if ( mapping == MAP_FAILED ) {
+
+        return failed( "map" );
+      }
+      segment->mapping = static_cast<char *>( mapping );
+      return segment;
+    }
+    catch ( const std::exception &_exception ) {
+
+      std::cout << _exception.what() << std::endl;
+    }
+    return nullptr;
+  }
+
+  void MmapFileLogger::closeSegment( Segment &_segment ) noexcept {
+
+    if ( _segment.mapping ) {
+
+      ::munmap( _segment.mapping, _segment.capacity - _segment.mapOffset );
+      _segment.mapping = nullptr;
+    }
+    if ( _segment.descriptor >= 0 ) {
+
+      /* cut the preallocated, unused tail */
+      if ( ::ftruncate( _segment.descriptor, static_cast<off_t>( _segment.end ) ) != 0 ) {
+
+        std::cout << "Cannot truncate " << _segment.name << ": " << std::strerror( errno ) << std::endl;
+      }
+      ::close( _segment.descriptor );
+      _segment.descriptor = -1;
+    }
+  }
+
+  void MmapFileLogger::roll( Segment *_segment,
+                             std::size_t _end,
+                             std::size_t _size ) noexcept {
+
+    std::unique_lock<std::mutex> lock( m_mutex );
+    _segment->end = _end;
+
+    std::unique_ptr<Segment> next = std::move( m_next );
+    if ( !next || next->capacity - next->end < _size ) {
+
+      /* the background thread was too slow or the record is larger than a segment */
+      if ( next ) {
+
+        m_next = std::move( next );
+      }
+      lock.unlock();
+      next = createSegment( std::max( m_segmentSize, _size ) );
+      lock.lock();
+    }
+
+    m_retired.push_back( std::move( m_active ) );
+    m_active = std::move( next );
+    m_lastRoll = std::chrono::steady_clock::now();
+    m_segment.store( m_active.get(), std::memory_order_release );
+    lock.unlock();
+    m_condition.notify_one();
+  }
+
+  void MmapFileLogger::run() noexcept {
+
+    const auto interval = std::max( reopenInterval(), std::chrono::seconds( 1 ) );
+
+    std::unique_lock<std::mutex> lock( m_mutex );
+    while ( !m_stop ) {
+
+      if ( !m_retired.empty() ) {
+
+        std::vector<std::unique_ptr<Segment>> retired {};
+        retired.swap( m_retired );
+        lock.unlock();
+        /* producers, that still copy into a retired segment, are readers of an older epoch */
+        m_epochs.synchronize();
+        for ( auto &segment : retired ) {
+
+          closeSegment( *segment );
+        }
+        lock.lock();
+        continue;
+      }
+
+      if ( !m_next ) {
+
+        lock.unlock();
+        std::unique_ptr<Segment> next = createSegment( m_segmentSize );
+        lock.lock();
+        if ( !next ) {
+
+          /* try again later, a roll or the stop may have happened while the lock was released */
+          m_condition.wait_for( lock, interval, [ this ] { return m_stop || !m_retired.empty(); } );
+          continue;
+        }
+        if ( m_next ) {
+
+          closeSegment( *next );
+          ::unlink( next->name.c_str() );
+        }
+        else {
+
+          m_next = std::move( next );
+        }
+      }
+
+      /* no segment could be created before */
+      if ( !m_active ) {
+
+        m_active = std::move( m_next );
+        m_lastRoll = std::chrono::steady_clock::now();
+        m_segment.store( m_active.get(), std::memory_order_release );
+        continue;
+      }
+
+      /* close segments with records after the reopen interval */
+      if ( std::chrono::steady_clock::now() - m_lastRoll >= interval ) {
+
+        Segment *segment = m_active.get();
+        if ( segment->reserved.load( std::memory_order_relaxed ) == segment->end ) {
+
+          m_lastRoll = std::chrono::steady_clock::now();
+          continue;
+        }
+
+        /* claim the segment like a record, that never fits */
+        lock.unlock();
+        const std::size_t offset = segment->reserved.fetch_add( segment->capacity + 1, std::memory_order_relaxed );
+        if ( offset <= segment->capacity ) {
+
+          roll( segment, offset, 0 );
+        }
+        lock.lock();
+        continue;
+      }
+
+      /* the predicate catches a notification, that came while the lock was released */
+      m_condition.wait_until( lock, m_lastRoll + interval, [ this ] { return m_stop || !m_retired.empty() || !m_next; } );
+    }
+  }
+}
+#endif
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+/* stl header */
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/* local header */
+#include "EpochDomain.h"
+#include "FileLogger.h"
+
+/**
+ * @brief vx (VX APPS) namespace.
+ */
+namespace vx {
+
+  /**
+   * @brief The MmapFileLogger class for writing messages to preallocated, memory mapped file segments (POSIX only).
+   * Producers reserve space with one atomic fetch-add and copy their record into the mapping, without any syscall.
+   * A background thread preallocates the next segment, a full segment rolls over to filename.1, filename.2 and so on,
+   * so the highest number is the newest segment, unlike the rotation of the file logger, where filename.1 is the newest file.
+   * The number of a preallocated segment, that was never used, is skipped.
+   * The file modes, the rotation and the compression of the file logger do not apply, they print a warning.
+   * Segments are also rolled after reopen_interval seconds and the unused tail of every segment is truncated, when it is closed.
+   * @author Florian Becker <fb\@vxapps.com> (VX APPS)
+   */
+  class MmapFileLogger : public FileLogger {
+
+  public:
+    /**
+     * @brief Deletet default constructor for MmapFileLogger.
+     */
+    MmapFileLogger() = delete;
+
+    /**
+     * @brief Default constructor for MmapFileLogger.
+     * @param _configuration   Logger configuration.
+     */
+    explicit MmapFileLogger( const std::unordered_map<std::string, std::string> &_configuration ) noexcept( false );
+
+    /**
+     * @brief Deleted copy constructor.
+     */
+    MmapFileLogger( const MmapFileLogger & ) = delete;
+
+    /**
+     * @brief Deleted move constructor.
+     */
+    MmapFileLogger( MmapFileLogger && ) = delete;
+
+    /**
+     * @brief Default destructor for MmapFileLogger - truncates the tail of the last segment.
+     */
+    ~MmapFileLogger() noexcept override;
+
+    /**
+     * @brief Deleted copy assign operator.
+     */
+    MmapFileLogger &operator=( const MmapFileLogger & ) = delete;
+
+    /**
+     * @brief Deleted move assign operator.
+     */
+    MmapFileLogger &operator=( MmapFileLogger && ) = delete;
+
+    /**
+     * @brief Schedule the write back of the current segment.
+     */
+    void flush() noexcept override;
+
+  protected:
+    /**
+     * @brief Copy the text into the current segment.
+     * @param _text   Text to write.
+     * @param _severity   Severity level of the text, records are visible in the file immediately.
+     */
+    void write( std::string_view _text,
+                Severity _severity ) noexcept override;
+
+  private:
+    /**
+     * @brief The Segment struct - one preallocated and mapped file.
+     */
+    struct Segment {
+
+      /**
+       * @brief File descriptor.
+       */
+      int descriptor = -1;
+
+      /**
+       * @brief Mapping of the file from mapOffset to capacity.
+       */
+      char *mapping = nullptr;
+
+      /**
+       * @brief File offset of the mapping, page aligned.
+       */
+      std::size_t mapOffset = 0;
+
+      /**
+       * @brief Preallocated size of the file.
+       */
+      std::size_t capacity = 0;
+
+      /**
+       * @brief End of the reserved records, may grow beyond capacity.
+       */
+      std::atomic<std::size_t> reserved { 0 };
+
+      /**
+       * @brief End of the written records, set when the segment is rolled.
+       */
+      std::size_t end = 0;
+
+      /**
+       * @brief Filename of the segment.
+       */
+      std::string name {};
+    };
+
+    /**
+     * @brief Create, preallocate and map the next segment.
+     * @param _size   Space for records at least.
+     * @return The segment or nullptr, if it cannot be created.
+     */
+    [[nodiscard]] std::unique_ptr<Segment> createSegment( std::size_t _size ) noexcept;
+
+    /**
+     * @brief Truncate the unused tail, unmap and close the segment.
+     * @param _segment   Segment to close.
+     */
+    static void closeSegment( Segment &_segment ) noexcept;
+
+    /**
+     * @brief Replace the full segment by the next one.
+     * @param _segment   Segment, that was claimed by the caller.
+     * @param _end   End of the written records in the segment.
+     * @param _size   Space the caller needs in the next segment.
+     */
+    void roll( Segment *_segment,
+               std::size_t _end,
+               std::size_t _size ) noexcept;
+
+    /**
+     * @brief Background thread, preallocates the next segment, rolls after the reopen interval and closes retired segments.
+     */
+    void run() noexcept;
+
+    /**
+     * @brief Size of a segment.
+     */
+    std::size_t m_segmentSize = 0;
+
+    /**
+     * @brief Index of the next segment file.
+     */
+    std::atomic<std::size_t> m_index { 0 };
+
+    /**
+     * @brief Current segment for the producers, nullptr if no segment could be created.
+     */
+    std::atomic<Segment *> m_segment { nullptr };
+
+    /**
+     * @brief Producers are readers of the current segment until it is closed.
+     */
+    EpochDomain m_epochs {};
+
+    /**
+     * @brief Owner of the current segment, guarded by m_mutex.
+     */
+    std::unique_ptr<Segment> m_active {};
+
+    /**
+     * @brief Preallocated next segment, guarded by m_mutex.
+     */
+    std::unique_ptr<Segment> m_next {};
+
+    /**
+     * @brief Rolled segments, that wait for their producers, guarded by m_mutex.
+     */
+    std::vector<std::unique_ptr<Segment>> m_retired {};
+
+    /**
+     * @brief Time of the last roll, guarded by m_mutex.
+     */
+    std::chrono::steady_clock::time_point m_lastRoll {};
+
+    /**
+     * @brief Background thread is asked to stop, guarded by m_mutex.
+     */
+    bool m_stop = false;
+
+    /**
+     * @brief Mutex for the segments.
+     */
+    std::mutex m_mutex {};
+
+    /**
+     * @brief Condition for waking up the background thread.
+     */
+    std::condition_variable m_condition {};
+
+    /**
+     * @brief Background thread.
+     */
+    std::thread m_background {};
+  };
+}
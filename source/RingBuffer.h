@@ -0,0 +1,365 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+/* stl header */
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief vx (VX APPS) namespace.
+ */
+namespace vx {
+
+  /**
+   * @brief Assumed size of a cache line to keep producer and consumer counters apart.
+   */
+  constexpr std::size_t cacheLineSize = 64;
+
+  /**
+   * @brief Round up to the next power of two.
+   * @param _value   Value to round up.
+   * @return Power of two, at least two.
+   */
+  constexpr std::size_t roundUpPowerOfTwo( std::size_t _value ) noexcept {
+
+    std::size_t result = 2;
+    while ( result < _value ) {
+
+      result <<= 1;
+    }
+    return result;
+  }
+
+  /**
+   * @brief The RingBuffer class - bounded lock-free multi-producer queue.
+   * Every cell carries a sequence number, so producers only contend on the
+   * enqueue position and never take a lock (Vyukov bounded queue).
+   * @author Florian Becker <fb\@vxapps.com> (VX APPS)
+   */
+  template <typename T>
+  class RingBuffer {
+
+  public:
+    /**
+     * @brief Default constructor for RingBuffer.
+     * @param _capacity   Minimum capacity, rounded up to the next power of two.
+     */
+    explicit RingBuffer( std::size_t _capacity )
+      : m_capacity( roundUpPowerOfTwo( _capacity ) ),
+        m_mask( m_capacity - 1 ),
+        m_cells( std::make_unique<Cell[]>( m_capacity ) ) {
+
+      for ( std::size_t i = 0; i < m_capacity; ++i ) {
+
+        m_cells[ i ].sequence.store( i, std::memory_order_relaxed );
+      }
+    }
+
+    /**
+     * @brief Deleted copy constructor.
+     */
+    RingBuffer( const RingBuffer & ) = delete;
+
+    /**
+     * @brief Deleted move constructor.
+     */
+    RingBuffer( RingBuffer && ) = delete;
+
+    /**
+     * @brief Default destructor for RingBuffer.
+     */
+    ~RingBuffer() = default;
+
+    /**
+     * @brief Deleted copy assign operator.
+     */
+    RingBuffer &operator=( const RingBuffer & ) = delete;
+
+    /**
+     * @brief Deleted move assign operator.
+     */
+    RingBuffer &operator=( RingBuffer && ) = delete;
+
+    /**
+     * @brief Enqueue a value, safe to call from multiple threads.
+     * @param _value   Value to enqueue.
+     * @return True, if enqueued - false, if the buffer is full.
+     */
+    [[nodiscard]] bool push( T &&_value ) noexcept( std::is_nothrow_move_constructible_v<T> ) {
+
+      std::size_t position = m_enqueue.load( std::memory_order_relaxed );
+      Cell *cell = nullptr;
+      while ( true ) {
+
+        cell = &m_cells[ position & m_mask ];
+        const std::size_t sequence = cell->sequence.load( std::memory_order_acquire );
+        if ( sequence == position ) {
+
+          if ( m_enqueue.compare_exchange_weak( position, position + 1, std::memory_order_relaxed ) ) {
+
+            break;
+          }
+        }
+        else if ( sequence < position ) {
+
+          /* the consumer did not free this cell yet */
+          return false;
+        }
+        else {
+
+          position = m_enqueue.load( std::memory_order_relaxed );
+        }
+      }
+      cell->value.emplace( std::move( _value ) );
+      cell->sequence.store( position + 1, std::memory_order_release );
+      return true;
+    }
+
+    /**
+     * @brief Dequeue the oldest value, must only be called from a single consumer.
+     * @return The value or nullopt, if the buffer is empty.
+     */
+    [[nodiscard]] std::optional<T> pop() noexcept( std::is_nothrow_move_constructible_v<T> ) {
+
+      const std::size_t position = m_dequeue.load( std::memory_order_relaxed );
+      Cell &cell = m_cells[ position & m_mask ];
+      if ( cell.sequence.load( std::memory_order_acquire ) != position + 1 ) {
+
+        return std::nullopt;
+      }
+      m_dequeue.store( position + 1, std::memory_order_relaxed );
+
+      std::optional<T> result( std::move( cell.value ) );
+      cell.value.reset();
+      cell.sequence.store( position + m_capacity, std::memory_order_release );
+      return result;
+    }
+
+    /**
+     * @brief Check, if the buffer is empty - only reliable from the consumer.
+     * @return True, if empty.
+     */
+    [[nodiscard]] bool empty() const noexcept {
+
+      const std::size_t position = m_dequeue.load( std::memory_order_relaxed );
+      return m_cells[ position & m_mask ].sequence.load( std::memory_order_acquire ) != position + 1;
+    }
+
+    /**
+     * @brief Capacity of the buffer.
+     * @return Number of cells.
+     */
+    [[nodiscard]] std::size_t capacity() const noexcept { return m_capacity; }
+
+  private:
+    /**
+     * @brief The Cell struct - one slot of the ring.
+     */
+    struct Cell {
+
+      /**
+       * @brief Sequence number, to detect free and filled cells.
+       */
+      std::atomic<std::size_t> sequence { 0 };
+
+      /**
+       * @brief Stored value.
+       */
+      std::optional<T> value {};
+    };
+
+    /**
+     * @brief Number of cells.
+     */
+    std::size_t m_capacity = 0;
+
+    /**
+     * @brief Mask to map a position to a cell.
+     */
+    std::size_t m_mask = 0;
+
+    /**
+     * @brief The cells.
+     */
+    std::unique_ptr<Cell[]> m_cells {};
+
+    /**
+     * @brief Producer position.
+     */
+    alignas( cacheLineSize ) std::atomic<std::size_t> m_enqueue { 0 };
+
+    /**
+     * @brief Consumer position.
+     */
+    alignas( cacheLineSize ) std::atomic<std::size_t> m_dequeue { 0 };
+  };
+
+  /**
+   * @brief The SingleProducerRingBuffer class - bounded lock-free single-producer single-consumer queue.
+   * Producer and consumer only share their own position counter each, so a
+   * buffer per thread never bounces a cache line between producers.
+   * @author Florian Becker <fb\@vxapps.com> (VX APPS)
+   */
+  template <typename T>
+  class SingleProducerRingBuffer {
+
+  public:
+    /**
+     * @brief Default constructor for SingleProducerRingBuffer.
+     * @param _capacity   Minimum capacity, rounded up to the next power of two.
+     */
+    explicit SingleProducerRingBuffer( std::size_t _capacity )
+      : m_capacity( roundUpPowerOfTwo( _capacity ) ),
+        m_mask( m_capacity - 1 ),
+        m_cells( std::make_unique<std::optional<T>[]>( m_capacity ) ) {}
+
+    /**
+     * @brief Deleted copy constructor.
+     */
+    SingleProducerRingBuffer( const SingleProducerRingBuffer & ) = delete;
+
+    /**
+     * @brief Deleted move constructor.
+     */
+    SingleProducerRingBuffer( SingleProducerRingBuffer && ) = delete;
+
+    /**
+     * @brief Default destructor for SingleProducerRingBuffer.
+     */
+    ~SingleProducerRingBuffer() = default;
+
+    /**
+     * @brief Deleted copy assign operator.
+     */
+    SingleProducerRingBuffer &operator=( const SingleProducerRingBuffer & ) = delete;
+
+    /**
+     * @brief Deleted move assign operator.
+     */
+    SingleProducerRingBuffer &operator=( SingleProducerRingBuffer && ) = delete;
+
+    /**
+     * @brief Enqueue a value, must only be called from the owning thread.
+     * @param _value   Value to enqueue.
+     * @return True, if enqueued - false, if the buffer is full.
+     */
+    [[nodiscard]] bool push( T &&_value ) noexcept( std::is_nothrow_move_constructible_v<T> ) {
+
+      const std::size_t tail = m_tail.load( std::memory_order_relaxed );
+      if ( tail - m_headCache == m_capacity ) {
+
+        m_headCache = m_head.load( std::memory_order_acquire );
+        if ( tail - m_headCache == m_capacity ) {
+
+          return false;
+        }
+      }
+      m_cells[ tail & m_mask ].emplace( std::move( _value ) );
+      m_tail.store( tail + 1, std::memory_order_release );
+      return true;
+    }
+
+    /**
+     * @brief Oldest value, without dequeuing it - consumer only.
+     * @return Pointer to the value or nullptr, if the buffer is empty.
+     */
+    [[nodiscard]] T *front() noexcept {
+
+      const std::size_t head = m_head.load( std::memory_order_relaxed );
+      if ( head == m_tailCache ) {
+
+        m_tailCache = m_tail.load( std::memory_order_acquire );
+        if ( head == m_tailCache ) {
+
+          return nullptr;
+        }
+      }
+      return &*m_cells[ head & m_mask ];
+    }
+
+    /**
+     * @brief Drop the oldest value - consumer only, after front() returned a value.
+     */
+    void pop() noexcept {
+
+      const std::size_t head = m_head.load( std::memory_order_relaxed );
+      m_cells[ head & m_mask ].reset();
+      m_head.store( head + 1, std::memory_order_release );
+    }
+
+    /**
+     * @brief Check, if the buffer is empty - consumer only.
+     * @return True, if empty.
+     */
+    [[nodiscard]] bool empty() noexcept { return front() == nullptr; }
+
+  private:
+    /**
+     * @brief Number of cells.
+     */
+    std::size_t m_capacity = 0;
+
+    /**
+     * @brief Mask to map a position to a cell.
+     */
+    std::size_t m_mask = 0;
+
+    /**
+     * @brief The cells.
+     */
+    std::unique_ptr<std::optional<T>[]> m_cells {};
+
+    /**
+     * @brief Producer position.
+     */
+    alignas( cacheLineSize ) std::atomic<std::size_t> m_tail { 0 };
+
+    /**
+     * @brief Consumer position, as last seen by the producer.
+     */
+    std::size_t m_headCache = 0;
+
+    /**
+     * @brief Consumer position.
+     */
+    alignas( cacheLineSize ) std::atomic<std::size_t> m_head { 0 };
+
+    /**
+     * @brief Producer position, as last seen by the consumer.
+     */
+    std::size_t m_tailCache = 0;
+  };
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+/* stl header */
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+/* magic enum */
+#include <magic_enum.hpp>
+
+/* local header */
+#include "Logger.h"
+
+/**
+ * @brief vx (VX APPS) namespace.
+ */
+namespace vx {
+
+  /**
+   * @brief Upper case severity names, indexed by Severity.
+   */
+  constexpr std::array<std::string_view, 6> severityNames = { "VERBOSE", "DEBUG", "INFO", "WARNING", "ERROR", "FATAL" };
+
+  /**
+   * @brief Finished severity labels of a log line, indexed by Severity.
+   */
+  constexpr std::array<std::string_view, 6> severityLabels = { " [VERBOSE] ", " [DEBUG] ", " [INFO] ", " [WARNING] ", " [ERROR] ", " [FATAL] " };
+
+  /**
+   * @brief Finished colored severity labels of a log line, indexed by Severity.
+   */
+  constexpr std::array<std::string_view, 6> coloredSeverityLabels = { " \x1b[37;1m[VERBOSE]\x1b[0m ",
+                                                                      " \x1b[34;1m[DEBUG]\x1b[0m ",
+                                                                      " \x1b[32;1m[INFO]\x1b[0m ",
+                                                                      " \x1b[33;1m[WARNING]\x1b[0m ",
+                                                                      " \x1b[31;1m[ERROR]\x1b[0m ",
+                                                                      " \x1b[41;1m[FATAL]\x1b[0m " };
+
+  /**
+   * @brief Check a table name against the enum name, ignoring the case.
+   * @param _name   Upper case name of the table.
+   * @param _severity   Severity of the table entry.
+   * @return True, if both match.
+   */
+  constexpr bool matchesEnumName( std::string_view _name,
+                                  Severity _severity ) noexcept {
+
+    const std::string_view enumName = magic_enum::enum_name( _severity );
+    if ( _name.size() != enumName.size() ) {
+
+      return false;
+    }
+    for ( std::size_t i = 0; i < _name.size(); ++i ) {
+
+      const char upper = enumName[ i ] >= 'a' && enumName[ i ] <= 'z' ? static_cast<char>( enumName[ i ] - 'a' + 'A' ) : enumName[ i ];
+      if ( _name[ i ] != upper ) {
+
+        return false;
+      }
+    }
+    return true;
+  }
+
+  static_assert( magic_enum::enum_count<Severity>() == severityNames.size(), "Every severity needs a label." );
+  static_assert( matchesEnumName( severityNames[ 0 ], Severity::Verbose ) && matchesEnumName( severityNames[ 1 ], Severity::Debug )
+                     && matchesEnumName( severityNames[ 2 ], Severity::Info ) && matchesEnumName( severityNames[ 3 ], Severity::Warning )
+                     && matchesEnumName( severityNames[ 4 ], Severity::Error ) && matchesEnumName( severityNames[ 5 ], Severity::Fatal ),
+                 "Severity labels must follow the enum." );
+
+  /**
+   * @brief Upper case name of the severity.
+   * @param _severity   Severity level.
+   * @return Name like INFO.
+   */
+  constexpr std::string_view severityName( Severity _severity ) noexcept {
+
+    return severityNames[ static_cast<std::size_t>( _severity ) ];
+  }
+
+  /**
+   * @brief Finished severity label of a log line.
+   * @param _severity   Severity level.
+   * @param _colored   Label with terminal colors.
+   * @return Label like " [INFO] ".
+   */
+  constexpr std::string_view severityLabel( Severity _severity,
+                                            bool _colored ) noexcept {
+
+    return _colored ? coloredSeverityLabels[ static_cast<std::size_t>( _severity ) ] : severityLabels[ static_cast<std::size_t>( _severity ) ];
+  }
+}
@@ -28,117 +28,263 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+/* system header */
+#if defined __unix__ || defined __APPLE__
+  #include <unistd.h>
+#endif
+
 /* stl header */
 #include <algorithm>
+#include <array>
 #include <iostream>
 #if defined __GNUC__ && __GNUC__ >= 10 || defined _MSC_VER && _MSC_VER >= 1929 || defined __clang__ && __clang_major__ >= 15
   #include <ranges>
 #endif
 #include <sstream>
 
-/* magic enum */
-#include <magic_enum.hpp>
-
-/* modern.cpp.core */
-#include <StringUtils.h>
-#include <Timestamp.h>
-
 /* local header */
 #include "StdLogger.h"
+#include "Descriptor.h"
+#include "SeverityLabel.h"
+#include "TimestampCache.h"
 
 namespace vx {
 
-  using timestamp::Precision;
-
   /**
    * @brief Reserved overhead for new log entry.
    */
   constexpr int overhead = 64;
 
+  /**
+   * @brief Default buffer size with flush block, a pipe takes this at once.
+   */
+  constexpr std::size_t bufferSize = 16384;
+
+  /**
+   * @brief Default maximum age of a buffered record in milliseconds.
+   */
+  constexpr std::size_t flushInterval = 1000;
+
+  /**
+   * @brief Shortest interval of the timer thread.
+   */
+  constexpr std::chrono::milliseconds timerInterval { 10 };
+
   StdLogger::StdLogger( const std::unordered_map<std::string, std::string> &_configuration ) noexcept
     : Logger( _configuration ),
       m_useColor( _configuration.find( "color" ) != std::end( _configuration ) ),
-      m_useStdErr( _configuration.find( "stderr" ) != std::end( _configuration ) ) {}
+      m_useStdErr( _configuration.find( "stderr" ) != std::end( _configuration ) ) {
 
-  void StdLogger::log( std::string_view _message,
-                       Severity _severity,
-                       const std::source_location &_location ) noexcept {
+    const auto mode = _configuration.find( "mode" );
+    if ( mode == _configuration.end() || mode->second != "direct" ) {
 
-    if ( avoidLogBelow > _severity ) {
+      if ( mode != _configuration.end() && mode->second != "stream" ) {
 
+        std::cout << mode->second << " is not a valid std mode, using mode stream." << std::endl;
+      }
       return;
     }
 
-    std::string output {};
-    output.reserve( _message.size() + overhead );
-    output.append( timestamp::iso8601( Precision::MicroSeconds ) );
-
-    std::string severity( magic_enum::enum_name( _severity ) );
-    string_utils::toUpper( severity );
-    if ( m_useColor ) {
-
-      switch ( _severity ) {
-
-        case Severity::Verbose:
-          output.append( " \x1b[37;1m[" + severity + "]\x1b[0m " );
-          break;
-        case Severity::Debug:
-          output.append( " \x1b[34;1m[" + severity + "]\x1b[0m " );
-          break;
-        case Severity::Info:
-          output.append( " \x1b[32;1m[" + severity + "]\x1b[0m " );
-          break;
-        case Severity::Warning:
-          output.append( " \x1b[33;1m[" + severity + "]\x1b[0m " );
-          break;
-        case Severity::Error:
-          output.append( " \x1b[31;1m[" + severity + "]\x1b[0m " );
-          break;
-        case Severity::Fatal:
-          output.append( " \x1b[41;1m[" + severity + "]\x1b[0m " );
-          break;
+#if defined __unix__ || defined __APPLE__
+    m_direct = true;
+    m_stdout.descriptor = STDOUT_FILENO;
+    m_stderr.descriptor = STDERR_FILENO;
+
+    /* a terminal shows every line at once, a pipe or a file takes blocks */
+    const auto flush = _configuration.find( "flush" );
+    const std::string policy = flush == _configuration.end() ? "auto" : flush->second;
+    if ( policy != "auto" && policy != "line" && policy != "block" ) {
+
+      std::cout << policy << " is not a valid flush, using auto." << std::endl;
+    }
+    m_stdout.lineFlush = policy == "line" || ( policy != "block" && ::isatty( m_stdout.descriptor ) == 1 );
+    m_stderr.lineFlush = policy == "line" || ( policy != "block" && ::isatty( m_stderr.descriptor ) == 1 );
+
+    /* the std logger cannot throw, an invalid value keeps its default */
+    const auto configured = [ &_configuration ]( const std::string &_key, std::size_t _default ) {
+      try {
+
+        return configuredValue( _configuration, _key, _default );
+      }
+      catch ( const std::exception &_exception ) {
+
+        std::cout << _exception.what() << " Using " << _default << "." << std::endl;
+      }
+      return _default;
+    };
+    m_bufferSize = configured( "buffer_size", bufferSize );
+    m_flushInterval = std::chrono::milliseconds( configured( "flush_interval", flushInterval ) );
+    if ( const auto severity = _configuration.find( "flush_severity" ); severity != _configuration.end() ) {
+
+      const auto value = severityFromName( severity->second );
+      if ( value ) {
+
+        m_flushSeverity = *value;
+      }
+      else {
+
+        std::cout << severity->second << " is not a valid flush severity." << std::endl;
       }
     }
-    else {
+    for ( Output *output : { &m_stdout, &m_stderr } ) {
+
+      if ( !output->lineFlush ) {
 
-      output.append( " [" + severity + "] " );
+        output->buffer.reserve( m_bufferSize );
+      }
     }
 
-    if ( std::string filename = std::string( _location.file_name() ); filename != "unsupported" ) {
+    /* a lone record in a buffer is written by the timer thread */
+    if ( ( !m_stdout.lineFlush || !m_stderr.lineFlush ) && m_bufferSize > 0 && m_flushInterval.count() > 0 ) {
 
-      if ( filename.find_last_of( '/' ) != std::string::npos ) {
+      try {
+
+        m_timer = std::thread( &StdLogger::run, this );
+      }
+      catch ( const std::exception &_exception ) {
 
-        const std::size_t pos = filename.find_last_of( '/' );
-        filename = filename.substr( pos + 1, filename.size() - ( pos + 1 ) );
+        /* the buffers are still written by the next record */
+        std::cout << _exception.what() << std::endl;
       }
-      output.append( filename );
+    }
+#else
+    std::cout << "Std mode direct needs file descriptors, using mode stream." << std::endl;
+#endif
+  }
+
+  StdLogger::~StdLogger() noexcept {
+
+    {
+      const std::lock_guard<std::mutex> lock( m_mutex );
+      m_stop = true;
+    }
+    m_condition.notify_one();
+    if ( m_timer.joinable() ) {
+
+      m_timer.join();
+    }
+    flush();
+  }
+
+  void StdLogger::log( const LogRecord &_record ) noexcept {
+
+    const std::string_view message = Logger::message( _record );
+    std::string output {};
+    output.reserve( message.size() + overhead );
+    TimestampCache::local().append( output, precision(), _record.timeOrNow() );
+
+    output.append( severityLabel( _record.severity, m_useColor ) );
+
+    if ( _record.location && _record.location->supported() ) {
+
+      output.append( _record.location->basename() );
       output.push_back( ':' );
-      output.append( std::to_string( _location.line() ) );
+      output.append( _record.location->lineText() );
       output.push_back( ' ' );
-      output.append( _location.function_name() );
+      output.append( _record.location->function_name() );
       output.push_back( ' ' );
     }
-    output.append( _message );
+    output.append( message );
     output.push_back( '\n' );
 
-    log( output );
+    /* routed by the severity of the record */
+    write( output, _record.severity );
   }
 
   void StdLogger::log( std::string_view _message ) noexcept {
 
-    /* cout is thread safe, to avoid multiple threads interleaving on one line */
-    /* though, we make sure to only call the << operator once on std::cout */
-    /* otherwise the << operators from different threads could interleave */
-    /* obviously we dont care if flushes interleave */
-    /* Not optimal to use find here, so if a message contains [FATAL] as text, it will match here */
-    if ( m_useStdErr && ( _message.find( "[FATAL]" ) != std::string_view::npos || _message.find( "[ERROR]" ) != std::string_view::npos ) ) {
+    /* only for compatibility, a raw message has no severity, so if a message contains [FATAL] as text, it will match here */
+    const bool error = _message.find( "[FATAL]" ) != std::string_view::npos || _message.find( "[ERROR]" ) != std::string_view::npos;
+    write( _message, error ? Severity::Error : Severity::Verbose );
+  }
 
-      std::cerr << _message;
+  void StdLogger::flush() noexcept {
+
+    if ( !m_direct ) {
+
+      std::cout.flush();
+      return;
     }
-    else {
 
-      std::cout << _message;
+    const std::lock_guard<std::mutex> lock( m_mutex );
+    writeOutput( m_stdout, {} );
+    writeOutput( m_stderr, {} );
+  }
+
+  void StdLogger::write( std::string_view _text,
+                         Severity _severity ) noexcept {
+
+    const bool useStdErr = m_useStdErr && _severity >= Severity::Error;
+    if ( !m_direct ) {
+
+      /* cout is thread safe, to avoid multiple threads interleaving on one line */
+      /* though, we make sure to only call the << operator once on std::cout */
+      /* otherwise the << operators from different threads could interleave */
+      /* obviously we dont care if flushes interleave, cerr is unbuffered anyway */
+      if ( useStdErr ) {
+
+        std::cerr << _text;
+      }
+      else {
+
+        std::cout << _text;
+        std::cout.flush();
+      }
+      return;
+    }
+
+    try {
+
+      const std::lock_guard<std::mutex> lock( m_mutex );
+      Output &output = useStdErr ? m_stderr : m_stdout;
+      if ( useStdErr ) {
+
+        /* the buffered records of stdout are older, a shared terminal shows them first */
+        writeOutput( m_stdout, {} );
+      }
+
+      const auto now = std::chrono::steady_clock::now();
+      if ( output.buffer.empty() ) {
+
+        output.pendingSince = now;
+      }
+      if ( output.lineFlush || _severity >= m_flushSeverity || output.buffer.size() + _text.size() >= m_bufferSize || now - output.pendingSince >= m_flushInterval ) {
+
+        writeOutput( output, _text );
+        return;
+      }
+      output.buffer.append( _text );
+    }
+    catch ( const std::exception &_exception ) {
+
+      std::cout << _exception.what() << std::endl;
+    }
+  }
+
+  void StdLogger::writeOutput( Output &_output,
+                               std::string_view _text ) noexcept {
+
+    /* one call writes the buffer and the record, nothing to do, if the output is gone */
+    const std::array<std::string_view, 2> parts = { _output.buffer, _text };
+    static_cast<void>( descriptor::writeAll( _output.descriptor, parts ) );
+    _output.buffer.clear();
+  }
+
+  void StdLogger::run() noexcept {
+
+    const auto interval = std::max( m_flushInterval, timerInterval );
+    std::unique_lock<std::mutex> lock( m_mutex );
+    while ( !m_condition.wait_for( lock, interval, [ this ] { return m_stop; } ) ) {
+
+      /* stdout first, as write does before a record of stderr */
+      const auto now = std::chrono::steady_clock::now();
+      for ( Output *output : { &m_stdout, &m_stderr } ) {
+
+        if ( !output->buffer.empty() && now - output->pendingSince >= m_flushInterval ) {
+
+          writeOutput( *output, {} );
+        }
+      }
     }
-    std::cout.flush();
   }
 }
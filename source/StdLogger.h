@@ -31,8 +31,12 @@
 #pragma once
 
 /* stl header */
+#include <chrono>
+#include <condition_variable>
 #include <iterator>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -46,6 +50,11 @@ namespace vx {
 
   /**
    * @brief The StdLogger class for writing messages to stdout.
+   * With mode direct (POSIX only) the records bypass the iostreams and are written to file descriptor 1 or 2
+   * from an own buffer. With flush line every record is written at once, with flush block the records
+   * are collected up to buffer_size bytes, flush_interval milliseconds or a record with at least flush_severity.
+   * The age is checked with the next record and by a timer thread, so a lone record in a pipe waits at most twice
+   * flush_interval. flush auto (default) uses line for a terminal and block for a pipe or a file.
    * @author Florian Becker <fb\@vxapps.com> (VX APPS)
    */
   class StdLogger : public Logger {
@@ -63,14 +72,28 @@ namespace vx {
     explicit StdLogger( const std::unordered_map<std::string, std::string> &_configuration ) noexcept;
 
     /**
-     * @brief Build the log message.
-     * @param _message   Message to log.
-     * @param _severity   Severity level of the message.
-     * @param _location   Source location information.
+     * @brief Default destructor for StdLogger, writes the buffered records.
+     */
+    ~StdLogger() noexcept override;
+
+    /**
+     * @brief Deleted copy constructor.
      */
-    void log( std::string_view _message,
-              Severity _severity,
-              const std::source_location &_location = std::source_location::current() ) noexcept override;
+    StdLogger( const StdLogger & ) = delete;
+
+    /**
+     * @brief Deleted copy assignment operator.
+     * @return Reference to this.
+     */
+    StdLogger &operator=( const StdLogger & ) = delete;
+
+    using Logger::log;
+
+    /**
+     * @brief Render the record and write it.
+     * @param _record   Record to log.
+     */
+    void log( const LogRecord &_record ) noexcept override;
 
     /**
      * @brief Output the log message.
@@ -78,7 +101,59 @@ namespace vx {
      */
     void log( std::string_view _message ) noexcept override;
 
+    /**
+     * @brief Write the buffered records in mode direct.
+     */
+    void flush() noexcept override;
+
   private:
+    /**
+     * @brief The Output struct - file descriptor and buffer of stdout or stderr in mode direct.
+     */
+    struct Output {
+
+      /**
+       * @brief File descriptor 1 or 2.
+       */
+      int descriptor = -1;
+
+      /**
+       * @brief Write every record at once, the output is a terminal or flush line is configured.
+       */
+      bool lineFlush = true;
+
+      /**
+       * @brief Records, not yet written.
+       */
+      std::string buffer {};
+
+      /**
+       * @brief Time of the oldest buffered record.
+       */
+      std::chrono::steady_clock::time_point pendingSince {};
+    };
+
+    /**
+     * @brief Write the record to stdout or to stderr.
+     * @param _text   Record to write.
+     * @param _severity   Severity level of the record.
+     */
+    void write( std::string_view _text,
+                Severity _severity ) noexcept;
+
+    /**
+     * @brief Write the buffered records and the text to the file descriptor, the lock has to be held.
+     * @param _output   Output to write.
+     * @param _text   Text to write after the buffer.
+     */
+    static void writeOutput( Output &_output,
+                             std::string_view _text ) noexcept;
+
+    /**
+     * @brief Timer thread, writes the buffers, whose oldest record is older than flush_interval.
+     */
+    void run() noexcept;
+
     /**
      * @brief Use colored message output.
      */
@@ -88,5 +163,55 @@ namespace vx {
      * @brief Use stderr for severity >= Error.
      */
     bool m_useStdErr = false;
+
+    /**
+     * @brief Write to the file descriptors instead of std::cout and std::cerr.
+     */
+    bool m_direct = false;
+
+    /**
+     * @brief Size of the buffer with flush block.
+     */
+    std::size_t m_bufferSize = 0;
+
+    /**
+     * @brief Maximum age of a buffered record with flush block.
+     */
+    std::chrono::milliseconds m_flushInterval {};
+
+    /**
+     * @brief Records with at least this severity are written immediately.
+     */
+    Severity m_flushSeverity = Severity::Error;
+
+    /**
+     * @brief Standard output in mode direct.
+     */
+    Output m_stdout {};
+
+    /**
+     * @brief Standard error in mode direct.
+     */
+    Output m_stderr {};
+
+    /**
+     * @brief Guards both outputs, so records of stdout and stderr keep their order.
+     */
+    std::mutex m_mutex {};
+
+    /**
+     * @brief Timer thread is asked to stop, guarded by m_mutex.
+     */
+    bool m_stop = false;
+
+    /**
+     * @brief Condition for waking up the timer thread.
+     */
+    std::condition_variable m_condition {};
+
+    /**
+     * @brief Timer thread with flush block.
+     */
+    std::thread m_timer {};
   };
 }
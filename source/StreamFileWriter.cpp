@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* stl header */
+#include <iostream>
+#include <utility>
+
+/* local header */
+#include "StreamFileWriter.h"
+
+namespace vx {
+
+  StreamFileWriter::StreamFileWriter( FileWriterSettings _settings,
+                                      std::ios_base::openmode _mode,
+                                      compression::Codec _compression,
+                                      int _compressionLevel ) noexcept
+      : FileWriter( std::move( _settings ) ),
+        m_mode( _mode ),
+        m_compression( _compression ),
+        m_compressionLevel( _compressionLevel ) {}
+
+  StreamFileWriter::~StreamFileWriter() noexcept {
+
+    flush();
+    for ( auto &handle : m_retired ) {
+
+      closeFile( *handle );
+    }
+    if ( m_prepared ) {
+
+      closeFile( *m_prepared );
+    }
+    FileHandle current {};
+    current.buffer = std::move( m_buffer );
+    current.file = std::move( m_file );
+    closeFile( current );
+  }
+
+  bool StreamFileWriter::open() noexcept {
+
+    try {
+
+      auto handle = std::make_unique<FileHandle>();
+      const std::size_t bufferSize = settings().bufferSize;
+      if ( bufferSize > 0 ) {
+
+        handle->buffer = std::make_unique<char[]>( bufferSize );
+      }
+      handle->file.exceptions( std::ofstream::failbit | std::ofstream::badbit );
+      /* the buffer has to be set before opening */
+      handle->file.rdbuf()->pubsetbuf( handle->buffer.get(), static_cast<std::streamsize>( bufferSize ) );
+      handle->file.open( settings().filename, m_compression != compression::Codec::None ? m_mode | std::ofstream::binary : m_mode );
+
+      const std::lock_guard<std::mutex> lock( m_mutex );
+      if ( m_prepared ) {
+
+        m_retired.push_back( std::move( m_prepared ) );
+      }
+      m_prepared = std::move( handle );
+      return true;
+    }
+    catch ( const std::exception &_exception ) {
+
+      /* nothing to do, file cannot be opened. */
+      std::cout << _exception.what() << std::endl;
+    }
+    return false;
+  }
+
+  bool StreamFileWriter::replace() noexcept {
+
+    const std::lock_guard<std::mutex> lock( m_mutex );
+    return swapPrepared();
+  }
+
+  void StreamFileWriter::write( std::string_view _text,
+                                Severity _severity ) noexcept {
+
+    const std::lock_guard<std::mutex> lock( m_mutex );
+
+    if ( replaceOnWrite() ) {
+
+      swapPrepared();
+    }
+    if ( m_compression != compression::Codec::None ) {
+
+      m_frame.append( _text );
+    }
+    else {
+
+      m_file << _text;
+    }
+    if ( _severity >= settings().flushSeverity || settings().bufferSize == 0 || m_frame.size() >= settings().bufferSize ) {
+
+      writePending();
+      return;
+    }
+
+    /* the buffer writes on its own, when it is full */
+    const auto now = std::chrono::steady_clock::now();
+    if ( !m_pending ) {
+
+      m_pending = true;
+      m_pendingSince = now;
+    }
+    else if ( now - m_pendingSince >= settings().flushInterval ) {
+
+      writePending();
+    }
+  }
+
+  void StreamFileWriter::flush() noexcept {
+
+    const std::lock_guard<std::mutex> lock( m_mutex );
+    writePending();
+  }
+
+  void StreamFileWriter::flushExpired( std::chrono::steady_clock::time_point _now ) noexcept {
+
+    const std::lock_guard<std::mutex> lock( m_mutex );
+    if ( m_pending && _now - m_pendingSince >= settings().flushInterval ) {
+
+      writePending();
+    }
+  }
+
+  bool StreamFileWriter::closeRetired() noexcept {
+
+    /* close the former files, outside of the lock of the writers */
+    std::vector<std::unique_ptr<FileHandle>> retired {};
+    bool replaced = false;
+    {
+      const std::lock_guard<std::mutex> lock( m_mutex );
+      retired.swap( m_retired );
+      replaced = !m_prepared;
+    }
+    for ( auto &handle : retired ) {
+
+      closeFile( *handle );
+    }
+    return replaced;
+  }
+
+  void StreamFileWriter::writePending() noexcept {
+
+    if ( m_file.is_open() ) {
+
+      writeFrame();
+      m_file.flush();
+    }
+    m_pending = false;
+  }
+
+  void StreamFileWriter::writeFrame() noexcept {
+
+    if ( m_frame.empty() ) {
+
+      return;
+    }
+
+    m_compressed.clear();
+    if ( compression::compressFrame( m_compression, m_compressionLevel, m_frame, m_compressed ) ) {
+
+      try {
+
+        m_file.write( m_compressed.data(), static_cast<std::streamsize>( m_compressed.size() ) );
+      }
+      catch ( const std::exception &_exception ) {
+
+        std::cout << _exception.what() << std::endl;
+      }
+    }
+    m_frame.clear();
+  }
+
+  bool StreamFileWriter::swapPrepared() noexcept {
+
+    if ( !m_prepared ) {
+
+      return false;
+    }
+
+    /* the collected records belong to the former file */
+    if ( m_file.is_open() ) {
+
+      writeFrame();
+    }
+
+    /* only pointers are swapped, the background thread closes the former file */
+    std::swap( m_buffer, m_prepared->buffer );
+    m_file.swap( m_prepared->file );
+    m_retired.push_back( std::move( m_prepared ) );
+    m_pending = false;
+    return true;
+  }
+
+  void StreamFileWriter::closeFile( FileHandle &_handle ) noexcept {
+
+    try {
+
+      /* closing writes the buffered records */
+      if ( _handle.file.is_open() ) {
+
+        _handle.file.close();
+      }
+    }
+    catch ( const std::exception &_exception ) {
+
+      /* nothing to do, file cannot be closed. */
+      std::cout << _exception.what() << std::endl;
+    }
+  }
+}
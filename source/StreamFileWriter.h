@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+/* stl header */
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/* local header */
+#include "Compression.h"
+#include "FileWriter.h"
+
+/**
+ * @brief vx (VX APPS) namespace.
+ */
+namespace vx {
+
+  /**
+   * @brief The StreamFileWriter class - writes the records of all threads to one buffered file stream (mode stream).
+   * With a codec every buffer is written as one compressed frame. A newly opened file is used from the next write on.
+   * @author Florian Becker <fb\@vxapps.com> (VX APPS)
+   */
+  class StreamFileWriter : public FileWriter {
+
+  public:
+    /**
+     * @brief Constructor for StreamFileWriter.
+     * @param _settings   Flush policy.
+     * @param _mode   Mode for opening the log file, e.g. with std::ofstream::binary.
+     * @param _compression   Codec of the records, none writes them as they are.
+     * @param _compressionLevel   Compression level.
+     */
+    StreamFileWriter( FileWriterSettings _settings,
+                      std::ios_base::openmode _mode,
+                      compression::Codec _compression,
+                      int _compressionLevel ) noexcept;
+
+    /**
+     * @brief Destructor for StreamFileWriter - writes the remaining records and closes all files.
+     */
+    ~StreamFileWriter() noexcept override;
+
+    /**
+     * @brief Open the log file again, the records switch to it with the next write.
+     * @return True, if the file is opened.
+     */
+    bool open() noexcept override;
+
+    /**
+     * @brief Switch to the newly opened file.
+     * @return True, if the records go to a new file from now on.
+     */
+    bool replace() noexcept override;
+
+    /**
+     * @brief Buffer the text and flush it, as configured.
+     * @param _text   Text to write.
+     * @param _severity   Severity level of the text.
+     */
+    void write( std::string_view _text,
+                Severity _severity ) noexcept override;
+
+    /**
+     * @brief Write all buffered records to the file.
+     */
+    void flush() noexcept override;
+
+    /**
+     * @brief Write the buffers, whose oldest record is older than the flush interval.
+     * @param _now   Current time.
+     */
+    void flushExpired( std::chrono::steady_clock::time_point _now ) noexcept override;
+
+    /**
+     * @brief Close the former files.
+     * @return True, if no opened file waits for the records.
+     */
+    bool closeRetired() noexcept override;
+
+  private:
+    /**
+     * @brief The FileHandle struct - an opened log file.
+     */
+    struct FileHandle {
+
+      /**
+       * @brief Buffer of the stream.
+       */
+      std::unique_ptr<char[]> buffer {};
+
+      /**
+       * @brief The stream.
+       */
+      std::ofstream file {};
+    };
+
+    /**
+     * @brief Hand the buffered records to the file, the lock has to be held.
+     */
+    void writePending() noexcept;
+
+    /**
+     * @brief Compress the collected records to one frame and write it, the lock has to be held.
+     */
+    void writeFrame() noexcept;
+
+    /**
+     * @brief Switch to the prepared file, the lock has to be held.
+     * @return True, if the records go to a new file from now on.
+     */
+    bool swapPrepared() noexcept;
+
+    /**
+     * @brief Write the remaining records and close the file.
+     * @param _handle   The file.
+     */
+    static void closeFile( FileHandle &_handle ) noexcept;
+
+    /**
+     * @brief Mode for opening the log file.
+     */
+    std::ios_base::openmode m_mode = std::ofstream::out | std::ofstream::app;
+
+    /**
+     * @brief Codec of the records.
+     */
+    compression::Codec m_compression = compression::Codec::None;
+
+    /**
+     * @brief Compression level.
+     */
+    int m_compressionLevel = 0;
+
+    /**
+     * @brief Buffer of the log file.
+     */
+    std::unique_ptr<char[]> m_buffer {};
+
+    /**
+     * @brief Log file handle.
+     */
+    std::ofstream m_file {};
+
+    /**
+     * @brief Records are buffered.
+     */
+    bool m_pending = false;
+
+    /**
+     * @brief Time of the oldest buffered record.
+     */
+    std::chrono::steady_clock::time_point m_pendingSince {};
+
+    /**
+     * @brief Records of the next frame.
+     */
+    std::string m_frame {};
+
+    /**
+     * @brief Compressed frame.
+     */
+    std::string m_compressed {};
+
+    /**
+     * @brief Newly opened file for the next write.
+     */
+    std::unique_ptr<FileHandle> m_prepared {};
+
+    /**
+     * @brief Former files, that closeRetired closes.
+     */
+    std::vector<std::unique_ptr<FileHandle>> m_retired {};
+
+    /**
+     * @brief Guards all members.
+     */
+    std::mutex m_mutex {};
+  };
+}
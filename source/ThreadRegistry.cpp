@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* stl header */
+#include <algorithm>
+
+/* local header */
+#include "ThreadRegistry.h"
+
+namespace vx {
+
+  /**
+   * @brief The ThreadEntries class - entries owned by the current thread.
+   */
+  class ThreadEntries {
+
+  public:
+    /**
+     * @brief Default constructor for ThreadEntries.
+     */
+    ThreadEntries() = default;
+
+    /**
+     * @brief Deleted copy constructor.
+     */
+    ThreadEntries( const ThreadEntries & ) = delete;
+
+    /**
+     * @brief Deleted move constructor.
+     */
+    ThreadEntries( ThreadEntries && ) = delete;
+
+    /**
+     * @brief Destructor for ThreadEntries - retires all entries at thread exit.
+     */
+    ~ThreadEntries() {
+
+      for ( const auto &[ registry, entry ] : m_entries ) {
+
+        entry->retired.store( true, std::memory_order_release );
+      }
+    }
+
+    /**
+     * @brief Deleted copy assign operator.
+     */
+    ThreadEntries &operator=( const ThreadEntries & ) = delete;
+
+    /**
+     * @brief Deleted move assign operator.
+     */
+    ThreadEntries &operator=( ThreadEntries && ) = delete;
+
+    /**
+     * @brief Find an entry.
+     * @param _registry   Id of the registry.
+     * @return Entry or nullptr.
+     */
+    [[nodiscard]] ThreadEntry *find( std::uint64_t _registry ) const noexcept {
+
+      const auto entry = std::find_if( std::begin( m_entries ), std::end( m_entries ), [ _registry ]( const auto &_entry ) { return _entry.first == _registry; } );
+      return entry != std::end( m_entries ) ? entry->second.get() : nullptr;
+    }
+
+    /**
+     * @brief Add an entry and drop those of destroyed registries.
+     * @param _registry   Id of the registry.
+     * @param _entry   The entry.
+     */
+    void add( std::uint64_t _registry,
+              std::shared_ptr<ThreadEntry> _entry ) {
+
+      m_entries.erase( std::remove_if( std::begin( m_entries ), std::end( m_entries ), []( const auto &_item ) { return _item.second->orphaned.load( std::memory_order_acquire ); } ), std::end( m_entries ) );
+      m_entries.emplace_back( _registry, std::move( _entry ) );
+    }
+
+  private:
+    /**
+     * @brief Entries with the id of their registry.
+     */
+    std::vector<std::pair<std::uint64_t, std::shared_ptr<ThreadEntry>>> m_entries {};
+  };
+
+#ifdef __clang__
+  #pragma clang diagnostic push
+  #pragma clang diagnostic ignored "-Wexit-time-destructors"
+#endif
+  /**
+   * @brief Entries of the current thread.
+   * @return The entries.
+   */
+  static ThreadEntries &threadEntries() noexcept {
+
+    thread_local ThreadEntries entries {};
+    return entries;
+  }
+#ifdef __clang__
+  #pragma clang diagnostic pop
+#endif
+
+  std::uint64_t nextThreadRegistryId() noexcept {
+
+    static std::atomic<std::uint64_t> id { 0 };
+    return ++id;
+  }
+
+  ThreadEntry *findThreadEntry( std::uint64_t _registry ) noexcept {
+
+    return threadEntries().find( _registry );
+  }
+
+  void addThreadEntry( std::uint64_t _registry,
+                       std::shared_ptr<ThreadEntry> _entry ) {
+
+    threadEntries().add( _registry, std::move( _entry ) );
+  }
+}
@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+/* stl header */
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief vx (VX APPS) namespace.
+ */
+namespace vx {
+
+  /**
+   * @brief The ThreadEntry struct - base of an object owned by one thread.
+   */
+  struct ThreadEntry {
+
+    /**
+     * @brief Default constructor for ThreadEntry.
+     */
+    ThreadEntry() = default;
+
+    /**
+     * @brief Deleted copy constructor.
+     */
+    ThreadEntry( const ThreadEntry & ) = delete;
+
+    /**
+     * @brief Deleted move constructor.
+     */
+    ThreadEntry( ThreadEntry && ) = delete;
+
+    /**
+     * @brief Default destructor for ThreadEntry.
+     */
+    virtual ~ThreadEntry() = default;
+
+    /**
+     * @brief Deleted copy assign operator.
+     */
+    ThreadEntry &operator=( const ThreadEntry & ) = delete;
+
+    /**
+     * @brief Deleted move assign operator.
+     */
+    ThreadEntry &operator=( ThreadEntry && ) = delete;
+
+    /**
+     * @brief The owning thread has exited.
+     */
+    std::atomic<bool> retired { false };
+
+    /**
+     * @brief The registry was destroyed, the owning thread can drop the entry.
+     */
+    std::atomic<bool> orphaned { false };
+  };
+
+  /**
+   * @brief Unique id for a new registry.
+   * @return Id, that is never reused.
+   */
+  std::uint64_t nextThreadRegistryId() noexcept;
+
+  /**
+   * @brief Find the entry of the calling thread.
+   * @param _registry   Id of the registry.
+   * @return Entry or nullptr, if the thread has no entry.
+   */
+  ThreadEntry *findThreadEntry( std::uint64_t _registry ) noexcept;
+
+  /**
+   * @brief Hand an entry to the calling thread, it is retired at thread exit.
+   * @param _registry   Id of the registry.
+   * @param _entry   The entry.
+   */
+  void addThreadEntry( std::uint64_t _registry,
+                       std::shared_ptr<ThreadEntry> _entry );
+
+  /**
+   * @brief The ThreadRegistry class - lazily creates one object per calling thread.
+   * Threads only take the registry lock on their first access, the owner can
+   * visit all objects and drops them, after their thread exited.
+   * @author Florian Becker <fb\@vxapps.com> (VX APPS)
+   */
+  template <typename T>
+  class ThreadRegistry {
+
+  public:
+    /**
+     * @brief The Entry struct - object of one thread.
+     */
+    struct Entry : ThreadEntry {
+
+      /**
+       * @brief Constructor for Entry.
+       * @param _args   Arguments for the object.
+       */
+      template <typename... Args>
+      explicit Entry( Args &&..._args )
+        : value( std::forward<Args>( _args )... ) {}
+
+      /**
+       * @brief The object.
+       */
+      T value;
+    };
+
+    /**
+     * @brief Default constructor for ThreadRegistry.
+     */
+    ThreadRegistry() = default;
+
+    /**
+     * @brief Deleted copy constructor.
+     */
+    ThreadRegistry( const ThreadRegistry & ) = delete;
+
+    /**
+     * @brief Deleted move constructor.
+     */
+    ThreadRegistry( ThreadRegistry && ) = delete;
+
+    /**
+     * @brief Destructor for ThreadRegistry - threads release their objects lazily.
+     */
+    ~ThreadRegistry() {
+
+      const std::lock_guard<std::mutex> lock( m_mutex );
+      for ( const auto &entry : m_entries ) {
+
+        entry->orphaned.store( true, std::memory_order_release );
+      }
+    }
+
+    /**
+     * @brief Deleted copy assign operator.
+     */
+    ThreadRegistry &operator=( const ThreadRegistry & ) = delete;
+
+    /**
+     * @brief Deleted move assign operator.
+     */
+    ThreadRegistry &operator=( ThreadRegistry && ) = delete;
+
+    /**
+     * @brief Object of the calling thread, created on first use.
+     * @param _args   Arguments for creating the object.
+     * @return The object.
+     */
+    template <typename... Args>
+    T &local( Args &&..._args ) {
+
+      thread_local std::pair<std::uint64_t, Entry *> cache { 0, nullptr };
+      if ( cache.first == m_id ) {
+
+        return cache.second->value;
+      }
+
+      auto *entry = static_cast<Entry *>( findThreadEntry( m_id ) );
+      if ( !entry ) {
+
+        auto created = std::make_shared<Entry>( std::forward<Args>( _args )... );
+        entry = created.get();
+        {
+          const std::lock_guard<std::mutex> lock( m_mutex );
+          m_entries.push_back( created );
+        }
+        m_generation.fetch_add( 1, std::memory_order_release );
+        addThreadEntry( m_id, std::move( created ) );
+      }
+      cache = { m_id, entry };
+      return entry->value;
+    }
+
+    /**
+     * @brief Visit all objects.
+     * @param _function   Called for every entry.
+     */
+    template <typename Function>
+    void forEach( Function &&_function ) {
+
+      const std::lock_guard<std::mutex> lock( m_mutex );
+      for ( const auto &entry : m_entries ) {
+
+        _function( *entry );
+      }
+    }
+
+    /**
+     * @brief Copy of all entries, to visit them without holding the registry lock.
+     * @return All entries.
+     */
+    [[nodiscard]] std::vector<std::shared_ptr<Entry>> snapshot() {
+
+      const std::lock_guard<std::mutex> lock( m_mutex );
+      return m_entries;
+    }
+
+    /**
+     * @brief Drop entries of exited threads.
+     * @param _done   Predicate, if the object of an exited thread can be dropped.
+     */
+    template <typename Predicate>
+    void collect( Predicate &&_done ) {
+
+      const std::lock_guard<std::mutex> lock( m_mutex );
+      const auto size = m_entries.size();
+      m_entries.erase( std::remove_if( std::begin( m_entries ), std::end( m_entries ), [ &_done ]( const auto &entry ) { return entry->retired.load( std::memory_order_acquire ) && _done( entry->value ); } ), std::end( m_entries ) );
+      if ( size != m_entries.size() ) {
+
+        m_generation.fetch_add( 1, std::memory_order_release );
+      }
+    }
+
+    /**
+     * @brief Generation, changes whenever an entry is added or dropped.
+     * @return Current generation.
+     */
+    [[nodiscard]] std::uint64_t generation() const noexcept { return m_generation.load( std::memory_order_acquire ); }
+
+  private:
+    /**
+     * @brief Id of the registry.
+     */
+    const std::uint64_t m_id = nextThreadRegistryId();
+
+    /**
+     * @brief Generation of the entries.
+     */
+    std::atomic<std::uint64_t> m_generation { 0 };
+
+    /**
+     * @brief Mutex for the entries.
+     */
+    std::mutex m_mutex {};
+
+    /**
+     * @brief All entries.
+     */
+    std::vector<std::shared_ptr<Entry>> m_entries {};
+  };
+}
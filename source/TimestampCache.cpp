@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* stl header */
+#include <ctime>
+
+/* local header */
+#include "TimestampCache.h"
+
+namespace vx {
+
+  using timestamp::Precision;
+
+  /**
+   * @brief Seconds per minute.
+   */
+  constexpr std::int64_t secondsPerMinute = 60;
+
+  /**
+   * @brief Digits of the fraction per precision.
+   * @param _precision   Precision of the fraction of the second.
+   * @return Number of digits.
+   */
+  static int fractionDigits( Precision _precision ) noexcept {
+
+    switch ( _precision ) {
+
+      case Precision::Seconds:
+        return 0;
+      case Precision::MilliSeconds:
+        return 3;
+      case Precision::MicroSeconds:
+        return 6;
+      case Precision::NanoSeconds:
+        return 9;
+    }
+    return 0;
+  }
+
+#ifdef __clang__
+  #pragma clang diagnostic push
+  #pragma clang diagnostic ignored "-Wexit-time-destructors"
+#endif
+  TimestampCache &TimestampCache::local() noexcept {
+
+    thread_local TimestampCache cache {};
+    return cache;
+  }
+#ifdef __clang__
+  #pragma clang diagnostic pop
+#endif
+
+  void TimestampCache::append( std::string &_output,
+                               Precision _precision ) noexcept {
+
+    append( _output, _precision, std::chrono::system_clock::now() );
+  }
+
+  void TimestampCache::append( std::string &_output,
+                               Precision _precision,
+                               std::chrono::system_clock::time_point _time ) noexcept {
+
+    const auto sinceEpoch = _time.time_since_epoch();
+    const auto second = std::chrono::floor<std::chrono::seconds>( sinceEpoch );
+    if ( second.count() != m_second ) {
+
+      render( second.count() );
+    }
+    _output.append( m_prefix.data(), m_prefixLength );
+
+    if ( const int digits = fractionDigits( _precision ); digits > 0 ) {
+
+      auto fraction = static_cast<std::uint64_t>( std::chrono::duration_cast<std::chrono::nanoseconds>( sinceEpoch - second ).count() );
+      for ( int i = digits; i < 9; ++i ) {
+
+        fraction /= 10;
+      }
+      std::array<char, 10> buffer {};
+      buffer[ 0 ] = '.';
+      for ( int i = digits; i > 0; --i ) {
+
+        buffer[ static_cast<std::size_t>( i ) ] = static_cast<char>( '0' + fraction % 10 );
+        fraction /= 10;
+      }
+      _output.append( buffer.data(), static_cast<std::size_t>( digits ) + 1 );
+    }
+    _output.append( m_zone.data(), m_zoneLength );
+  }
+
+  void TimestampCache::render( std::int64_t _second ) noexcept {
+
+    const std::int64_t minute = _second >= 0 ? _second / secondsPerMinute : ( _second - secondsPerMinute + 1 ) / secondsPerMinute;
+    const auto seconds = static_cast<int>( _second - minute * secondsPerMinute );
+    m_second = _second;
+
+    /* within the same minute only the seconds change */
+    if ( minute == m_minute && m_prefixLength >= 2 ) {
+
+      m_prefix[ m_prefixLength - 2 ] = static_cast<char>( '0' + seconds / 10 );
+      m_prefix[ m_prefixLength - 1 ] = static_cast<char>( '0' + seconds % 10 );
+      return;
+    }
+    m_minute = minute;
+
+    const auto time = static_cast<std::time_t>( _second );
+    std::tm calendar {};
+#if defined _WIN32
+    localtime_s( &calendar, &time );
+#else
+    localtime_r( &time, &calendar );
+#endif
+    m_prefixLength = std::strftime( m_prefix.data(), m_prefix.size(), "%Y-%m-%dT%H:%M:%S", &calendar );
+
+    /* +hhmm to +hh:mm */
+    std::array<char, 16> zone {};
+    const std::size_t zoneLength = std::strftime( zone.data(), zone.size(), "%z", &calendar );
+    if ( zoneLength == 5 ) {
+
+      m_zone = { zone[ 0 ], zone[ 1 ], zone[ 2 ], ':', zone[ 3 ], zone[ 4 ] };
+      m_zoneLength = 6;
+    }
+    else {
+
+      m_zone = zone;
+      m_zoneLength = zoneLength;
+    }
+  }
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+/* stl header */
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <string>
+
+/* modern.cpp.core */
+#include <Timestamp.h>
+
+/**
+ * @brief vx (VX APPS) namespace.
+ */
+namespace vx {
+
+  /**
+   * @brief The TimestampCache class - ISO 8601 timestamps, that only re-render changed fields.
+   * Date, hour, minute and timezone are rendered once per minute, the seconds once per second.
+   * Only the fraction of the second is rendered per call.
+   * @author Florian Becker <fb\@vxapps.com> (VX APPS)
+   */
+  class TimestampCache {
+
+  public:
+    /**
+     * @brief Cache of the calling thread.
+     * @return The cache.
+     */
+    static TimestampCache &local() noexcept;
+
+    /**
+     * @brief Append the current time.
+     * @param _output   Text is appended here.
+     * @param _precision   Precision of the fraction of the second.
+     */
+    void append( std::string &_output,
+                 timestamp::Precision _precision ) noexcept;
+
+    /**
+     * @brief Append the time.
+     * @param _output   Text is appended here.
+     * @param _precision   Precision of the fraction of the second.
+     * @param _time   Time to append.
+     */
+    void append( std::string &_output,
+                 timestamp::Precision _precision,
+                 std::chrono::system_clock::time_point _time ) noexcept;
+
+  private:
+    /**
+     * @brief Render date, time and timezone of the second.
+     * @param _second   Seconds since epoch.
+     */
+    void render( std::int64_t _second ) noexcept;
+
+    /**
+     * @brief Cached second since epoch.
+     */
+    std::int64_t m_second = std::numeric_limits<std::int64_t>::min();
+
+    /**
+     * @brief Cached minute since epoch.
+     */
+    std::int64_t m_minute = std::numeric_limits<std::int64_t>::min();
+
+    /**
+     * @brief Rendered YYYY-MM-DDTHH:MM:SS.
+     */
+    std::array<char, 32> m_prefix {};
+
+    /**
+     * @brief Length of the rendered prefix.
+     */
+    std::size_t m_prefixLength = 0;
+
+    /**
+     * @brief Rendered timezone like +01:00.
+     */
+    std::array<char, 16> m_zone {};
+
+    /**
+     * @brief Length of the rendered timezone.
+     */
+    std::size_t m_zoneLength = 0;
+  };
+}
@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* system header */
+#if defined __unix__ || defined __APPLE__
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
+
+/* stl header */
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <utility>
+
+/* local header */
+#include "Descriptor.h"
+#include "UringFileWriter.h"
+
+namespace vx {
+
+  UringFileWriter::UringFileWriter( FileWriterSettings _settings,
+                                    std::size_t _bufferSize,
+                                    std::size_t _bufferCount,
+                                    bool _fixed ) noexcept
+      : FileWriter( std::move( _settings ) ),
+        m_bufferSize( _bufferSize ),
+        m_bufferCount( _bufferCount ),
+        m_fixed( _fixed ) {}
+
+  UringFileWriter::~UringFileWriter() noexcept {
+
+    for ( auto &handle : m_retired ) {
+
+      closeFile( *handle );
+    }
+    if ( m_prepared ) {
+
+      closeFile( *m_prepared );
+    }
+    closeFile( m_current );
+  }
+
+  bool UringFileWriter::open() noexcept {
+
+#if defined __unix__ || defined __APPLE__
+    try {
+
+      auto handle = std::make_unique<FileHandle>();
+
+      /* io_uring writes every buffer at its own offset, O_APPEND could reorder them */
+      handle->descriptor = ::open( settings().filename.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC, 0644 );
+      if ( handle->descriptor < 0 ) {
+
+        std::cout << "Cannot open " << settings().filename << ": " << std::strerror( errno ) << std::endl;
+        return false;
+      }
+      handle->uring = UringWriter::create( handle->descriptor, m_bufferSize, m_bufferCount, m_fixed );
+      if ( !handle->uring ) {
+
+        ::fcntl( handle->descriptor, F_SETFL, O_APPEND );
+      }
+
+      const std::lock_guard<std::mutex> lock( m_mutex );
+      if ( m_prepared ) {
+
+        m_retired.push_back( std::move( m_prepared ) );
+      }
+      m_prepared = std::move( handle );
+      return true;
+    }
+    catch ( const std::exception &_exception ) {
+
+      /* nothing to do, file cannot be opened. */
+      std::cout << _exception.what() << std::endl;
+    }
+#endif
+    return false;
+  }
+
+  bool UringFileWriter::replace() noexcept {
+
+    const std::lock_guard<std::mutex> lock( m_mutex );
+    return swapPrepared();
+  }
+
+  void UringFileWriter::write( std::string_view _text,
+                               Severity _severity ) noexcept {
+
+    const std::lock_guard<std::mutex> lock( m_mutex );
+
+    if ( replaceOnWrite() ) {
+
+      swapPrepared();
+    }
+    if ( !m_current.uring ) {
+
+      /* io_uring failed for this file */
+      const std::array<std::string_view, 1> parts = { _text };
+      if ( !descriptor::writeAll( m_current.descriptor, parts ) ) {
+
+        std::cout << "Cannot write " << settings().filename << ": " << std::strerror( errno ) << std::endl;
+      }
+      return;
+    }
+
+    m_current.uring->append( _text );
+    const auto now = std::chrono::steady_clock::now();
+    if ( _severity >= settings().flushSeverity || settings().bufferSize == 0 || ( m_pending && now - m_pendingSince >= settings().flushInterval ) ) {
+
+      /* submit only, the buffer is recycled when its completion arrives */
+      m_current.uring->submit();
+      m_pending = false;
+      return;
+    }
+    if ( !m_pending ) {
+
+      m_pending = true;
+      m_pendingSince = now;
+    }
+  }
+
+  void UringFileWriter::flush() noexcept {
+
+    const std::lock_guard<std::mutex> lock( m_mutex );
+
+    /* the records are in the file, when all buffers are written */
+    if ( m_current.uring ) {
+
+      m_current.uring->wait();
+    }
+    m_pending = false;
+  }
+
+  void UringFileWriter::flushExpired( std::chrono::steady_clock::time_point _now ) noexcept {
+
+    const std::lock_guard<std::mutex> lock( m_mutex );
+    if ( m_pending && m_current.uring && _now - m_pendingSince >= settings().flushInterval ) {
+
+      m_current.uring->submit();
+      m_pending = false;
+    }
+  }
+
+  bool UringFileWriter::closeRetired() noexcept {
+
+    /* close the former files, outside of the lock of the writers */
+    std::vector<std::unique_ptr<FileHandle>> retired {};
+    bool replaced = false;
+    {
+      const std::lock_guard<std::mutex> lock( m_mutex );
+      retired.swap( m_retired );
+      replaced = !m_prepared;
+    }
+    for ( auto &handle : retired ) {
+
+      closeFile( *handle );
+    }
+    return replaced;
+  }
+
+  bool UringFileWriter::swapPrepared() noexcept {
+
+    if ( !m_prepared ) {
+
+      return false;
+    }
+
+    /* the former file keeps its buffers in flight, closing it waits for them */
+    std::swap( m_current, *m_prepared );
+    m_retired.push_back( std::move( m_prepared ) );
+    m_pending = false;
+    return true;
+  }
+
+  void UringFileWriter::closeFile( FileHandle &_handle ) noexcept {
+
+    /* the writer waits for its buffers */
+    _handle.uring.reset();
+#if defined __unix__ || defined __APPLE__
+    if ( _handle.descriptor >= 0 ) {
+
+      ::close( _handle.descriptor );
+      _handle.descriptor = -1;
+    }
+#endif
+  }
+}
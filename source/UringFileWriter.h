@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+/* stl header */
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/* local header */
+#include "FileWriter.h"
+#include "UringWriter.h"
+
+/**
+ * @brief vx (VX APPS) namespace.
+ */
+namespace vx {
+
+  /**
+   * @brief The UringFileWriter class - collects the records in buffers, that are written through io_uring
+   * while the next one is filled (mode uring, Linux only). A file without a ring is written with writev.
+   * The offsets are taken from the end of the file, when it is opened, so the logger has to be its only writer.
+   * A newly opened file is used from the next write on.
+   * @author Florian Becker <fb\@vxapps.com> (VX APPS)
+   */
+  class UringFileWriter : public FileWriter {
+
+  public:
+    /**
+     * @brief Constructor for UringFileWriter.
+     * @param _settings   Flush policy, a buffer size of zero uses the default size for the ring buffers.
+     * @param _bufferSize   Size of every ring buffer.
+     * @param _bufferCount   Number of ring buffers.
+     * @param _fixed   Register the buffers and the file with the ring.
+     */
+    UringFileWriter( FileWriterSettings _settings,
+                     std::size_t _bufferSize,
+                     std::size_t _bufferCount,
+                     bool _fixed ) noexcept;
+
+    /**
+     * @brief Destructor for UringFileWriter - waits for all buffers and closes all files.
+     */
+    ~UringFileWriter() noexcept override;
+
+    /**
+     * @brief Open the log file again, the records switch to it with the next write.
+     * @return True, if the file is opened.
+     */
+    bool open() noexcept override;
+
+    /**
+     * @brief Switch to the newly opened file.
+     * @return True, if the records go to a new file from now on.
+     */
+    bool replace() noexcept override;
+
+    /**
+     * @brief Copy the text into the current buffer and submit it, as configured.
+     * @param _text   Text to write.
+     * @param _severity   Severity level of the text.
+     */
+    void write( std::string_view _text,
+                Severity _severity ) noexcept override;
+
+    /**
+     * @brief Wait, until all buffers are written.
+     */
+    void flush() noexcept override;
+
+    /**
+     * @brief Write the buffers, whose oldest record is older than the flush interval.
+     * @param _now   Current time.
+     */
+    void flushExpired( std::chrono::steady_clock::time_point _now ) noexcept override;
+
+    /**
+     * @brief Close the former files.
+     * @return True, if no opened file waits for the records.
+     */
+    bool closeRetired() noexcept override;
+
+  private:
+    /**
+     * @brief The FileHandle struct - an opened log file.
+     */
+    struct FileHandle {
+
+      /**
+       * @brief Writer of the file, nullptr without io_uring.
+       */
+      std::unique_ptr<UringWriter> uring {};
+
+      /**
+       * @brief File descriptor.
+       */
+      int descriptor = -1;
+    };
+
+    /**
+     * @brief Switch to the prepared file, the lock has to be held.
+     * @return True, if the records go to a new file from now on.
+     */
+    bool swapPrepared() noexcept;
+
+    /**
+     * @brief Wait for the buffers and close the file.
+     * @param _handle   The file.
+     */
+    static void closeFile( FileHandle &_handle ) noexcept;
+
+    /**
+     * @brief Size of every ring buffer.
+     */
+    std::size_t m_bufferSize = 0;
+
+    /**
+     * @brief Number of ring buffers.
+     */
+    std::size_t m_bufferCount = 0;
+
+    /**
+     * @brief Register the buffers and the file with the ring.
+     */
+    bool m_fixed = true;
+
+    /**
+     * @brief Current file.
+     */
+    FileHandle m_current {};
+
+    /**
+     * @brief Records are buffered.
+     */
+    bool m_pending = false;
+
+    /**
+     * @brief Time of the oldest buffered record.
+     */
+    std::chrono::steady_clock::time_point m_pendingSince {};
+
+    /**
+     * @brief Newly opened file for the next write.
+     */
+    std::unique_ptr<FileHandle> m_prepared {};
+
+    /**
+     * @brief Former files, that closeRetired closes.
+     */
+    std::vector<std::unique_ptr<FileHandle>> m_retired {};
+
+    /**
+     * @brief Guards all members.
+     */
+    std::mutex m_mutex {};
+  };
+}
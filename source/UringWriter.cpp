@@ -0,0 +1,380 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* system header */
+#if defined __linux__ && __has_include( <linux/io_uring.h> )
+  #include <linux/io_uring.h>
+  #include <sys/mman.h>
+  #include <sys/syscall.h>
+  #include <sys/uio.h>
+  #include <unistd.h>
+#endif
+
+/* stl header */
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+
+/* local header */
+#include "UringWriter.h"
+
+namespace vx {
+
+#if defined __linux__ && __has_include( <linux/io_uring.h> )
+  std::unique_ptr<UringWriter> UringWriter::create( int _descriptor,
+                                                    std::size_t _bufferSize,
+                                                    std::size_t _bufferCount,
+                                                    bool _fixed ) noexcept {
+
+    try {
+
+      std::unique_ptr<UringWriter> writer( new UringWriter() );
+      writer->m_descriptor = _descriptor;
+      writer->m_bufferSize = _bufferSize;
+      writer->m_memory = std::make_unique<char[]>( _bufferSize * _bufferCount );
+      writer->m_buffers.resize( _bufferCount );
+      writer->m_free.reserve( _bufferCount );
+      for ( std::size_t index = 0; index < _bufferCount; ++index ) {
+
+        writer->m_buffers[ index ].data = writer->m_memory.get() + index * _bufferSize;
+        writer->m_free.push_back( _bufferCount - 1 - index );
+      }
+
+      /* the records follow the end of the file */
+      const off_t end = ::lseek( _descriptor, 0, SEEK_END );
+      if ( end < 0 ) {
+
+        return nullptr;
+      }
+      writer->m_offset = static_cast<std::uint64_t>( end );
+
+      if ( !writer->setup( _fixed ) ) {
+
+        return nullptr;
+      }
+      return writer;
+    }
+    catch ( const std::exception &_exception ) {
+
+      std::cout << _exception.what() << std::endl;
+    }
+    return nullptr;
+  }
+
+  bool UringWriter::available() noexcept {
+
+    io_uring_params parameters {};
+    const auto ring = static_cast<int>( ::syscall( __NR_io_uring_setup, 1, &parameters ) );
+    if ( ring < 0 ) {
+
+      std::cout << "Cannot setup io_uring: " << std::strerror( errno ) << std::endl;
+      return false;
+    }
+    ::close( ring );
+    return true;
+  }
+
+  UringWriter::~UringWriter() noexcept {
+
+    if ( m_ring >= 0 && m_entries ) {
+
+      wait();
+    }
+    if ( m_entries ) {
+
+      ::munmap( m_entries, m_entriesSize );
+    }
+    if ( m_completeMapping ) {
+
+      ::munmap( m_completeMapping, m_completeMappingSize );
+    }
+    if ( m_submitMapping ) {
+
+      ::munmap( m_submitMapping, m_submitMappingSize );
+    }
+    if ( m_ring >= 0 ) {
+
+      /* closing the ring drops the registered buffers and the file */
+      ::close( m_ring );
+    }
+  }
+
+  bool UringWriter::setup( bool _fixed ) noexcept {
+
+    io_uring_params parameters {};
+    const auto entries = static_cast<unsigned int>( m_buffers.size() );
+    m_ring = static_cast<int>( ::syscall( __NR_io_uring_setup, entries, &parameters ) );
+    if ( m_ring < 0 ) {
+
+      std::cout << "Cannot setup io_uring: " << std::strerror( errno ) << std::endl;
+      return false;
+    }
+
+    m_submitMappingSize = parameters.sq_off.array + parameters.sq_entries * sizeof( unsigned int );
+    m_completeMappingSize = parameters.cq_off.cqes + parameters.cq_entries * sizeof( io_uring_cqe );
+    const bool single = ( parameters.features & IORING_FEAT_SINGLE_MMAP ) != 0;
+    if ( single ) {
+
+      m_submitMappingSize = std::max( m_submitMappingSize, m_completeMappingSize );
+    }
+    void *submitMapping = ::mmap( nullptr, m_submitMappingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ring, IORING_OFF_SQ_RING );
+    if ( submitMapping == MAP_FAILED ) {
+
+      return false;
+    }
+    m_submitMapping = submitMapping;
+
+    void *completeMapping = submitMapping;
+    if ( !single ) {
+
+      completeMapping = ::mmap( nullptr, m_completeMappingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ring, IORING_OFF_CQ_RING );
+      if ( completeMapping == MAP_FAILED ) {
+
+        return false;
+      }
+      m_completeMapping = completeMapping;
+    }
+
+    m_entriesSize = parameters.sq_entries * sizeof( io_uring_sqe );
+    void *entriesMapping = ::mmap( nullptr, m_entriesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ring, IORING_OFF_SQES );
+    if ( entriesMapping == MAP_FAILED ) {
+
+      return false;
+    }
+    m_entries = entriesMapping;
+
+    char *submit = static_cast<char *>( submitMapping );
+    m_submitTail = reinterpret_cast<unsigned int *>( submit + parameters.sq_off.tail );
+    m_submitMask = *reinterpret_cast<unsigned int *>( submit + parameters.sq_off.ring_mask );
+    m_submitArray = reinterpret_cast<unsigned int *>( submit + parameters.sq_off.array );
+
+    char *complete = static_cast<char *>( completeMapping );
+    m_completeHead = reinterpret_cast<unsigned int *>( complete + parameters.cq_off.head );
+    m_completeTail = reinterpret_cast<unsigned int *>( complete + parameters.cq_off.tail );
+    m_completeMask = *reinterpret_cast<unsigned int *>( complete + parameters.cq_off.ring_mask );
+    m_completions = complete + parameters.cq_off.cqes;
+
+    if ( _fixed ) {
+
+      /* registering is optional, e.g. the locked memory limit might be too small */
+      m_fixedFile = ::syscall( __NR_io_uring_register, m_ring, IORING_REGISTER_FILES, &m_descriptor, 1 ) == 0;
+      std::vector<iovec> vectors( m_buffers.size() );
+      for ( std::size_t index = 0; index < m_buffers.size(); ++index ) {
+
+        vectors[ index ] = { m_buffers[ index ].data, m_bufferSize };
+      }
+      m_fixedBuffers = ::syscall( __NR_io_uring_register, m_ring, IORING_REGISTER_BUFFERS, vectors.data(), static_cast<unsigned int>( vectors.size() ) ) == 0;
+    }
+    return true;
+  }
+
+  void UringWriter::append( std::string_view _text ) noexcept {
+
+    while ( !_text.empty() ) {
+
+      if ( m_current == none && !acquire() ) {
+
+        return;
+      }
+
+      Buffer &buffer = m_buffers[ m_current ];
+      const std::size_t size = std::min( _text.size(), m_bufferSize - buffer.size );
+      std::memcpy( buffer.data + buffer.size, _text.data(), size );
+      buffer.size += size;
+      _text.remove_prefix( size );
+      if ( buffer.size == m_bufferSize ) {
+
+        submit();
+      }
+    }
+  }
+
+  void UringWriter::submit() noexcept {
+
+    if ( m_current == none || m_buffers[ m_current ].size == 0 ) {
+
+      return;
+    }
+
+    Buffer &buffer = m_buffers[ m_current ];
+    buffer.offset = m_offset;
+    buffer.written = 0;
+    m_offset += buffer.size;
+    enqueue( m_current );
+    m_current = none;
+  }
+
+  void UringWriter::wait() noexcept {
+
+    submit();
+    while ( m_inFlight > 0 || m_unsubmitted > 0 ) {
+
+      if ( !enter( m_inFlight > 0 ? 1 : 0 ) ) {
+
+        return;
+      }
+      reap();
+    }
+  }
+
+  bool UringWriter::acquire() noexcept {
+
+    reap();
+    while ( m_free.empty() ) {
+
+      /* all buffers are in flight or still queued */
+      if ( ( m_inFlight == 0 && m_unsubmitted == 0 ) || !enter( m_inFlight > 0 ? 1 : 0 ) ) {
+
+        return false;
+      }
+      reap();
+    }
+
+    m_current = m_free.back();
+    m_free.pop_back();
+    m_buffers[ m_current ].size = 0;
+    return true;
+  }
+
+  void UringWriter::enqueue( std::size_t _index ) noexcept {
+
+    const Buffer &buffer = m_buffers[ _index ];
+    const unsigned int tail = *m_submitTail;
+    const unsigned int slot = tail & m_submitMask;
+
+    io_uring_sqe &entry = static_cast<io_uring_sqe *>( m_entries )[ slot ];
+    std::memset( &entry, 0, sizeof( entry ) );
+    entry.opcode = m_fixedBuffers ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE;
+    entry.fd = m_fixedFile ? 0 : m_descriptor;
+    entry.flags = m_fixedFile ? IOSQE_FIXED_FILE : 0;
+    entry.addr = reinterpret_cast<std::uint64_t>( buffer.data + buffer.written );
+    entry.len = static_cast<std::uint32_t>( buffer.size - buffer.written );
+    entry.off = buffer.offset + buffer.written;
+    entry.buf_index = static_cast<std::uint16_t>( m_fixedBuffers ? _index : 0 );
+    entry.user_data = _index;
+    m_submitArray[ slot ] = slot;
+
+    /* the entry has to be visible, before the kernel sees the new tail */
+    std::atomic_ref<unsigned int>( *m_submitTail ).store( tail + 1, std::memory_order_release );
+    ++m_unsubmitted;
+    if ( !enter( 0 ) ) {
+
+      /* the entry stays queued, the next enter hands it to the kernel again */
+      std::cout << "Cannot submit to io_uring: " << std::strerror( errno ) << std::endl;
+    }
+  }
+
+  void UringWriter::reap() noexcept {
+
+    unsigned int head = *m_completeHead;
+    const unsigned int tail = std::atomic_ref<unsigned int>( *m_completeTail ).load( std::memory_order_acquire );
+    while ( head != tail ) {
+
+      const io_uring_cqe &completion = static_cast<const io_uring_cqe *>( m_completions )[ head & m_completeMask ];
+      const auto index = static_cast<std::size_t>( completion.user_data );
+      const int result = completion.res;
+      ++head;
+      --m_inFlight;
+
+      Buffer &buffer = m_buffers[ index ];
+      if ( result == -EINTR || result == -EAGAIN ) {
+
+        enqueue( index );
+        continue;
+      }
+      if ( result <= 0 ) {
+
+        std::cout << "Cannot write with io_uring: " << std::strerror( -result ) << std::endl;
+        m_free.push_back( index );
+        continue;
+      }
+
+      buffer.written += static_cast<std::size_t>( result );
+      if ( buffer.written < buffer.size ) {
+
+        /* short write, the rest follows at its offset */
+        enqueue( index );
+        continue;
+      }
+      m_free.push_back( index );
+    }
+    std::atomic_ref<unsigned int>( *m_completeHead ).store( head, std::memory_order_release );
+  }
+
+  bool UringWriter::enter( unsigned int _complete ) noexcept {
+
+    const unsigned int flags = _complete > 0 ? IORING_ENTER_GETEVENTS : 0;
+    long submitted = 0;
+    while ( ( submitted = ::syscall( __NR_io_uring_enter, m_ring, m_unsubmitted, _complete, flags, nullptr, 0 ) ) < 0 ) {
+
+      if ( errno != EINTR && errno != EAGAIN && errno != EBUSY ) {
+
+        return false;
+      }
+    }
+
+    /* only the entries, that the kernel took, are in flight */
+    const auto taken = static_cast<unsigned int>( submitted );
+    m_unsubmitted -= taken;
+    m_inFlight += taken;
+    if ( taken == 0 && m_unsubmitted > 0 && _complete == 0 ) {
+
+      /* nothing was taken and nothing will complete, the caller must not wait for it */
+      errno = EAGAIN;
+      return false;
+    }
+    return true;
+  }
+#else
+  std::unique_ptr<UringWriter> UringWriter::create( int _descriptor,
+                                                    std::size_t _bufferSize,
+                                                    std::size_t _bufferCount,
+                                                    bool _fixed ) noexcept {
+
+    static_cast<void>( _descriptor );
+    static_cast<void>( _bufferSize );
+    static_cast<void>( _bufferCount );
+    static_cast<void>( _fixed );
+    return nullptr;
+  }
+
+  bool UringWriter::available() noexcept { return false; }
+
+  UringWriter::~UringWriter() noexcept = default;
+
+  void UringWriter::append( std::string_view _text ) noexcept { static_cast<void>( _text ); }
+
+  void UringWriter::submit() noexcept {}
+
+  void UringWriter::wait() noexcept {}
+#endif
+}
@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+/* stl header */
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief vx (VX APPS) namespace.
+ */
+namespace vx {
+
+  /**
+   * @brief The UringWriter class - writes buffers to a file through io_uring (Linux only).
+   * Several buffers are in flight at once, every buffer is written at its own file offset, so
+   * the order in the file is kept, and recycled when its completion arrives. With fixed, the
+   * buffers and the file are registered with the ring. Not thread-safe, the owner serializes the calls.
+   * @author Florian Becker <fb\@vxapps.com> (VX APPS)
+   */
+  class UringWriter {
+
+  public:
+    /**
+     * @brief Create the ring and the buffers.
+     * @param _descriptor   File descriptor, opened without O_APPEND.
+     * @param _bufferSize   Size of every buffer.
+     * @param _bufferCount   Number of buffers, that can be in flight.
+     * @param _fixed   Register the buffers and the file with the ring.
+     * @return The writer or nullptr, if io_uring is not available.
+     */
+    [[nodiscard]] static std::unique_ptr<UringWriter> create( int _descriptor,
+                                                              std::size_t _bufferSize,
+                                                              std::size_t _bufferCount,
+                                                              bool _fixed ) noexcept;
+
+    /**
+     * @brief Probe, if a ring can be set up, io_uring might be disabled or blocked, e.g. by seccomp.
+     * @return True, if io_uring is available.
+     */
+    [[nodiscard]] static bool available() noexcept;
+
+    /**
+     * @brief Deleted copy constructor.
+     */
+    UringWriter( const UringWriter & ) = delete;
+
+    /**
+     * @brief Deleted move constructor.
+     */
+    UringWriter( UringWriter && ) = delete;
+
+    /**
+     * @brief Destructor for UringWriter - waits for all writes.
+     */
+    ~UringWriter() noexcept;
+
+    /**
+     * @brief Deleted copy assign operator.
+     */
+    UringWriter &operator=( const UringWriter & ) = delete;
+
+    /**
+     * @brief Deleted move assign operator.
+     */
+    UringWriter &operator=( UringWriter && ) = delete;
+
+    /**
+     * @brief Copy the text into the current buffer, full buffers are submitted.
+     * @param _text   Text to write.
+     */
+    void append( std::string_view _text ) noexcept;
+
+    /**
+     * @brief Submit the current buffer.
+     */
+    void submit() noexcept;
+
+    /**
+     * @brief Submit the current buffer and wait, until all buffers are written.
+     */
+    void wait() noexcept;
+
+    /**
+     * @brief Buffers are registered with the ring.
+     * @return True, if the writes use registered buffers and a fixed file.
+     */
+    [[nodiscard]] bool fixed() const noexcept { return m_fixedBuffers; }
+
+  private:
+    /**
+     * @brief Default constructor for UringWriter.
+     */
+    UringWriter() = default;
+
+    /**
+     * @brief The Buffer struct - one buffer of the pool.
+     */
+    struct Buffer {
+
+      /**
+       * @brief Memory of the buffer.
+       */
+      char *data = nullptr;
+
+      /**
+       * @brief Filled bytes.
+       */
+      std::size_t size = 0;
+
+      /**
+       * @brief Bytes already written.
+       */
+      std::size_t written = 0;
+
+      /**
+       * @brief File offset of the first byte.
+       */
+      std::uint64_t offset = 0;
+    };
+
+    /**
+     * @brief No current buffer.
+     */
+    static constexpr std::size_t none = std::numeric_limits<std::size_t>::max();
+
+    /**
+     * @brief Map the rings, register the buffers and the file.
+     * @param _fixed   Register the buffers and the file with the ring.
+     * @return True, if the ring can be used.
+     */
+    bool setup( bool _fixed ) noexcept;
+
+    /**
+     * @brief Take a free buffer as current buffer, waits for a completion if all are in flight.
+     * @return True, if a buffer is available.
+     */
+    bool acquire() noexcept;
+
+    /**
+     * @brief Queue the unwritten rest of the buffer and hand it to the kernel.
+     * @param _index   Index of the buffer.
+     */
+    void enqueue( std::size_t _index ) noexcept;
+
+    /**
+     * @brief Recycle written buffers and queue the rest of short writes.
+     */
+    void reap() noexcept;
+
+    /**
+     * @brief Enter the ring, hands all queued entries to the kernel.
+     * @param _complete   Number of completions to wait for.
+     * @return True on success, otherwise the entries, that the kernel did not take, stay queued.
+     */
+    bool enter( unsigned int _complete ) noexcept;
+
+    /**
+     * @brief File descriptor of the ring.
+     */
+    int m_ring = -1;
+
+    /**
+     * @brief File descriptor of the log file.
+     */
+    int m_descriptor = -1;
+
+    /**
+     * @brief The file is registered with the ring.
+     */
+    bool m_fixedFile = false;
+
+    /**
+     * @brief The buffers are registered with the ring.
+     */
+    bool m_fixedBuffers = false;
+
+    /**
+     * @brief Mapping of the submission queue.
+     */
+    void *m_submitMapping = nullptr;
+
+    /**
+     * @brief Size of the submission queue mapping.
+     */
+    std::size_t m_submitMappingSize = 0;
+
+    /**
+     * @brief Mapping of the completion queue, if it is not shared with the submission queue.
+     */
+    void *m_completeMapping = nullptr;
+
+    /**
+     * @brief Size of the completion queue mapping.
+     */
+    std::size_t m_completeMappingSize = 0;
+
+    /**
+     * @brief Mapping of the submission queue entries.
+     */
+    void *m_entries = nullptr;
+
+    /**
+     * @brief Size of the submission queue entries mapping.
+     */
+    std::size_t m_entriesSize = 0;
+
+    /**
+     * @brief Tail of the submission queue, written by us.
+     */
+    unsigned int *m_submitTail = nullptr;
+
+    /**
+     * @brief Mask of the submission queue.
+     */
+    unsigned int m_submitMask = 0;
+
+    /**
+     * @brief Index array of the submission queue.
+     */
+    unsigned int *m_submitArray = nullptr;
+
+    /**
+     * @brief Head of the completion queue, written by us.
+     */
+    unsigned int *m_completeHead = nullptr;
+
+    /**
+     * @brief Tail of the completion queue, written by the kernel.
+     */
+    unsigned int *m_completeTail = nullptr;
+
+    /**
+     * @brief Mask of the completion queue.
+     */
+    unsigned int m_completeMask = 0;
+
+    /**
+     * @brief Completion queue entries.
+     */
+    void *m_completions = nullptr;
+
+    /**
+     * @brief Size of every buffer.
+     */
+    std::size_t m_bufferSize = 0;
+
+    /**
+     * @brief Memory of all buffers.
+     */
+    std::unique_ptr<char[]> m_memory {};
+
+    /**
+     * @brief All buffers.
+     */
+    std::vector<Buffer> m_buffers {};
+
+    /**
+     * @brief Indexes of the free buffers.
+     */
+    std::vector<std::size_t> m_free {};
+
+    /**
+     * @brief Index of the current buffer.
+     */
+    std::size_t m_current = none;
+
+    /**
+     * @brief Number of writes, that the kernel took and did not complete yet.
+     */
+    std::size_t m_inFlight = 0;
+
+    /**
+     * @brief Number of queued entries, that the kernel did not take yet.
+     */
+    unsigned int m_unsubmitted = 0;
+
+    /**
+     * @brief File offset for the next buffer.
+     */
+    std::uint64_t m_offset = 0;
+  };
+}
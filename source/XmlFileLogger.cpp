@@ -34,20 +34,14 @@
   #include <ranges>
 #endif
 
-/* magic enum */
-#include <magic_enum.hpp>
-
-/* modern.cpp.core */
-#include <StringUtils.h>
-#include <Timestamp.h>
-
 /* local header */
 #include "XmlFileLogger.h"
+#include "Escape.h"
+#include "SeverityLabel.h"
+#include "TimestampCache.h"
 
 namespace vx {
 
-  using timestamp::Precision;
-
   /**
    * @brief Reserved overhead for new xml log entry.
    */
@@ -56,44 +50,57 @@ namespace vx {
   XmlFileLogger::XmlFileLogger( const std::unordered_map<std::string, std::string> &_configuration )
       : FileLogger( _configuration ) {}
 
-  void XmlFileLogger::log( std::string_view _message,
-                           Severity _severity,
-                           const std::source_location &_location ) noexcept {
-
-    if ( avoidLogBelow > _severity ) {
-
-      return;
-    }
+  void XmlFileLogger::log( const LogRecord &_record ) noexcept {
 
+    const std::string_view message = Logger::message( _record );
     std::string output {};
-    output.reserve( _message.size() + xmlOverhead );
+    output.reserve( message.size() + xmlOverhead );
     output.append( "<entry>" );
     output.append( "<timestamp>" );
-    output.append( timestamp::iso8601( Precision::MicroSeconds ) );
+    TimestampCache::local().append( output, precision(), _record.timeOrNow() );
     output.append( "</timestamp>" );
-    if ( std::string( _location.file_name() ) != "unsupported" ) {
+    if ( _record.location && _record.location->supported() ) {
 
       output.append( "<filename>" );
-      output.append( _location.file_name() );
+      escape::appendXml( output, _record.location->file_name() );
       output.append( "</filename>" );
       output.append( "<line>" );
-      output.append( std::to_string( _location.line() ) );
+      output.append( _record.location->lineText() );
       output.append( "</line>" );
       output.append( "<function>" );
-      output.append( _location.function_name() );
+      escape::appendXml( output, _record.location->function_name() );
       output.append( "</function>" );
     }
 
-    std::string severity( magic_enum::enum_name( _severity ) );
-    string_utils::toUpper( severity );
     output.append( "<severity>" );
-    output.append( severity );
+    output.append( severityName( _record.severity ) );
     output.append( "</severity>" );
     output.append( "<message>" );
-    output.append( _message );
+    escape::appendXml( output, message );
+    output.append( "</message>" );
+    output.append( "</entry>\n" );
+
+    write( output, _record.severity );
+  }
+
+  void XmlFileLogger::log( std::string_view _message ) noexcept {
+
+    /* the text is no xml, it becomes the message of an entry without a severity */
+    if ( _message.ends_with( '\n' ) ) {
+
+      _message.remove_suffix( 1 );
+    }
+    std::string output {};
+    output.reserve( _message.size() + xmlOverhead );
+    output.append( "<entry>" );
+    output.append( "<timestamp>" );
+    TimestampCache::local().append( output, precision() );
+    output.append( "</timestamp>" );
+    output.append( "<message>" );
+    escape::appendXml( output, _message );
     output.append( "</message>" );
     output.append( "</entry>\n" );
 
-    FileLogger::log( output );
+    write( output, Severity::Verbose );
   }
 }
@@ -60,14 +60,18 @@ namespace vx {
      */
     explicit XmlFileLogger( const std::unordered_map<std::string, std::string> &_configuration ) noexcept( false );
 
+    using Logger::log;
+
+    /**
+     * @brief Render the record and write it.
+     * @param _record   Record to log.
+     */
+    void log( const LogRecord &_record ) noexcept override;
+
     /**
-     * @brief Build the log message.
+     * @brief Write an already built message as entry with timestamp and message.
      * @param _message   Message to log.
-     * @param _severity   Severity level of the message.
-     * @param _location   Source location information.
      */
-    void log( std::string_view _message,
-              Severity _severity,
-              const std::source_location &_location = std::source_location::current() ) noexcept override;
+    void log( std::string_view _message ) noexcept override;
   };
 }
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* cppunit header */
+#ifdef __clang__
+  #pragma clang diagnostic push
+  #pragma clang diagnostic ignored "-Weverything"
+#endif
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Weffc++"
+#endif
+#include <gtest/gtest.h>
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif
+#ifdef __clang__
+  #pragma clang diagnostic pop
+#endif
+
+/* stl header */
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string_view>
+
+/* modern.cpp.logger */
+#include <LoggerFactory.h>
+
+using ::testing::InitGoogleTest;
+using ::testing::Test;
+
+/**
+ * @brief Log message itself, longer than any small string buffer.
+ */
+constexpr std::string_view logMessage = "This is a log message, that is too long for the small string optimization";
+
+/**
+ * @brief Count of heap allocations.
+ */
+static std::atomic<std::size_t> allocationCount { 0 };
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void *operator new( std::size_t _size ) {
+
+  allocationCount.fetch_add( 1, std::memory_order_relaxed );
+  if ( void *memory = std::malloc( _size ? _size : 1 ) ) {
+
+    return memory;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete( void *_memory ) noexcept {
+
+  std::free( _memory );
+}
+
+void operator delete( void *_memory,
+                      [[maybe_unused]] std::size_t _size ) noexcept {
+
+  std::free( _memory );
+}
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif
+
+#ifdef __clang__
+  #pragma clang diagnostic push
+  #pragma clang diagnostic ignored "-Wglobal-constructors"
+#endif
+namespace vx {
+
+  TEST( Allocation, Literal ) {
+
+    /* /dev/null logger, the caller side is measured only */
+    ConfigureLogger( { { "type", "" } } );
+    SetLogSeverity( Severity::Verbose );
+
+    /* the first round registers the thread and the call sites */
+    std::size_t before = 0;
+    for ( int round = 0; round < 2; ++round ) {
+
+      before = allocationCount.load( std::memory_order_relaxed );
+      LogFatal( "This is a log message, that is too long for the small string optimization" );
+      LogError( "This is a log message, that is too long for the small string optimization" );
+      LogWarning( "This is a log message, that is too long for the small string optimization" );
+      LogInfo( "This is a log message, that is too long for the small string optimization" );
+      LogDebug( "This is a log message, that is too long for the small string optimization" );
+      LogVerbose( "This is a log message, that is too long for the small string optimization" );
+      Log( "This is a log message, that is too long for the small string optimization", Severity::Fatal );
+      LogFatal( logMessage );
+    }
+    const std::size_t after = allocationCount.load( std::memory_order_relaxed );
+
+    EXPECT_EQ( before, after );
+  }
+}
+#ifdef __clang__
+  #pragma clang diagnostic pop
+#endif
+
+int main( int argc, char **argv ) {
+
+  InitGoogleTest( &argc, argv );
+  return RUN_ALL_TESTS();
+}
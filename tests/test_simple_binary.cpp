@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* cppunit header */
+#ifdef __clang__
+  #pragma clang diagnostic push
+  #pragma clang diagnostic ignored "-Weverything"
+#endif
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Weffc++"
+#endif
+#include <gtest/gtest.h>
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif
+#ifdef __clang__
+  #pragma clang diagnostic pop
+#endif
+
+/* stl header */
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <regex>
+#include <sstream>
+#include <vector>
+
+/* modern.cpp.logger */
+#include <BinaryDecoder.h>
+#include <LoggerFactory.h>
+
+using ::testing::InitGoogleTest;
+using ::testing::Test;
+
+/**
+ * @brief Filename of temporary binary log file.
+ */
+constexpr std::string_view binaryFilename = "test.bin";
+
+/**
+ * @brief Filename of temporary log file.
+ */
+constexpr std::string_view logFilename = "test.log";
+
+/**
+ * @brief Count of log messages.
+ */
+constexpr std::size_t logMessageCount = 1000;
+
+/**
+ * @brief Log message itself.
+ */
+constexpr std::string_view logMessage = "This is a log message";
+
+#ifdef __clang__
+  #pragma clang diagnostic push
+  #pragma clang diagnostic ignored "-Wglobal-constructors"
+#endif
+namespace vx {
+
+  /**
+   * @brief Path of a temporary file.
+   * @param _filename   Filename.
+   * @return Path in the temp directory.
+   */
+  static std::string tmpFile( std::string_view _filename ) {
+
+    std::filesystem::path tmpPath = std::filesystem::temp_directory_path();
+    tmpPath /= _filename;
+    return tmpPath.string();
+  }
+
+  /**
+   * @brief Read and remove a file.
+   * @param _filename   File to read.
+   * @return Content of the file.
+   */
+  static std::string readFile( const std::string &_filename ) {
+
+    std::ifstream input( _filename, std::ifstream::binary );
+    std::string content { std::istreambuf_iterator<char>( input ), std::istreambuf_iterator<char>() };
+    input.close();
+    std::filesystem::remove( _filename );
+    return content;
+  }
+
+  /**
+   * @brief Lines without the timestamp.
+   * @param _text   Log text.
+   * @return Lines from the severity on.
+   */
+  static std::vector<std::string> withoutTimestamps( const std::string &_text ) {
+
+    std::vector<std::string> lines {};
+    std::istringstream stream( _text );
+    for ( std::string line; std::getline( stream, line ); ) {
+
+      const std::size_t severity = line.find( " [" );
+      lines.push_back( severity == std::string::npos ? line : line.substr( severity ) );
+    }
+    return lines;
+  }
+
+  TEST( Binary, Decode ) {
+
+    const std::string binaryFile = tmpFile( binaryFilename );
+    const std::string textFile = tmpFile( logFilename );
+    {
+      std::unique_ptr<Logger> binaryLogger = LoggerFactory::instance().produce( { { "type", "binary" }, { "filename", binaryFile } } );
+      std::unique_ptr<Logger> textLogger = LoggerFactory::instance().produce( { { "type", "file" }, { "filename", textFile } } );
+
+      /* both loggers see the same call sites */
+      const CallSite location = std::source_location::current();
+      const CallSite unsupported = std::source_location::current( "unsupported", "unsupported", 0 );
+      for ( Logger *logger : { binaryLogger.get(), textLogger.get() } ) {
+
+        for ( std::size_t i = 0; i < logMessageCount; ++i ) {
+
+          logger->log( logMessage, Severity::Fatal, location );
+          logger->logDeferred( DeferredMessage( "id={} ratio={:.2f} ok={} {{{}}}", static_cast<int>( i ), 0.5, true, 'x' ), Severity::Warning, location );
+          logger->logDeferred( DeferredMessage( "{1:>4}|{0:#x}|{2:+}", std::uint8_t { 255 }, std::int64_t { -7 }, 1.5F ), Severity::Error, location );
+          logger->logDeferred( DeferredMessage( "missing {} {}", 1 ), Severity::Info, unsupported );
+          logger->log( "raw message\n" );
+        }
+      }
+    }
+
+    const std::string binary = readFile( binaryFile );
+    const std::string text = readFile( textFile );
+    std::string decoded {};
+    EXPECT_TRUE( BinaryDecoder().decode( binary, decoded ) );
+
+    EXPECT_EQ( withoutTimestamps( text ), withoutTimestamps( decoded ) );
+    EXPECT_TRUE( std::regex_search( decoded, std::regex( R"(^\d{4}-\d{2}-\d{2}T\d{2}:\d{2}:\d{2}\.\d{6}[+-]\d{2}:\d{2} \[FATAL\] )" ) ) );
+    EXPECT_LE( binary.size() * 4, text.size() );
+  }
+
+  TEST( Binary, Async ) {
+
+    const std::string binaryFile = tmpFile( binaryFilename );
+    {
+      ConfigureLogger( { { "type", "async" }, { "sink", "binary" }, { "filename", binaryFile } } );
+      for ( std::size_t i = 0; i < logMessageCount; ++i ) {
+
+        LogFatal( "value={} half={:.1f}", i, static_cast<double>( i ) / 2 );
+        LogFatal( logMessage );
+      }
+      ConfigureLogger( { { "type", "" } } );
+    }
+
+    const std::string binary = readFile( binaryFile );
+    std::string decoded {};
+    EXPECT_TRUE( BinaryDecoder().decode( binary, decoded ) );
+
+    const std::vector<std::string> lines = withoutTimestamps( decoded );
+    ASSERT_EQ( logMessageCount * 2, lines.size() );
+    EXPECT_NE( std::string::npos, lines[ 2 ].find( "value=1 half=0.5" ) );
+    EXPECT_NE( std::string::npos, lines[ 3 ].find( logMessage ) );
+
+    /* a truncated file decodes up to the last complete frame */
+    std::string truncated {};
+    EXPECT_FALSE( BinaryDecoder().decode( std::string_view( binary ).substr( 0, binary.size() - 1 ), truncated ) );
+    EXPECT_EQ( std::count( truncated.begin(), truncated.end(), '\n' ), static_cast<std::ptrdiff_t>( logMessageCount * 2 - 1 ) );
+  }
+
+  TEST( Binary, Mode ) {
+
+    const std::string binaryFile = tmpFile( binaryFilename );
+
+    /* the frames are written with mode stream, the user is told so */
+    testing::internal::CaptureStdout();
+    std::unique_ptr<Logger> logger = LoggerFactory::instance().produce( { { "type", "binary" }, { "filename", binaryFile }, { "mode", "append" } } );
+    const std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_NE( std::string::npos, output.find( "File mode append is not supported by the binary logger, using mode stream." ) );
+    logger->log( logMessage, Severity::Fatal );
+    logger.reset();
+
+    std::string decoded {};
+    EXPECT_TRUE( BinaryDecoder().decode( readFile( binaryFile ), decoded ) );
+    EXPECT_NE( std::string::npos, decoded.find( logMessage ) );
+
+    EXPECT_THROW( static_cast<void>( LoggerFactory::instance().produce( { { "type", "binary" }, { "filename", binaryFile }, { "mode", "unknown" } } ) ), std::invalid_argument );
+    std::filesystem::remove( binaryFile );
+  }
+}
+#ifdef __clang__
+  #pragma clang diagnostic pop
+#endif
+
+int main( int argc, char **argv ) {
+
+  InitGoogleTest( &argc, argv );
+  return RUN_ALL_TESTS();
+}
@@ -45,6 +45,11 @@
   #pragma clang diagnostic pop
 #endif
 
+/* stl header */
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
 /* modern.cpp.logger */
 #include <LoggerFactory.h>
 
@@ -88,6 +93,65 @@ namespace vx {
 
     EXPECT_TRUE( true );
   }
+
+  TEST( Cout, Direct ) {
+
+    /* captured stdout is a file, flush auto collects the records in blocks */
+    for ( const std::string flush : { "auto", "line", "block" } ) {
+
+      testing::internal::CaptureStdout();
+      ConfigureLogger( { { "type", "std" }, { "mode", "direct" }, { "flush", flush } } );
+      for ( std::size_t i = 0; i < logMessageCount; ++i ) {
+
+        LogWarning( logMessage );
+      }
+
+      /* with flush line every record is written, when log returns */
+      if ( flush != "line" ) {
+
+        FlushLogger();
+      }
+      const std::string output = testing::internal::GetCapturedStdout();
+      ConfigureLogger( { { "type", "" } } );
+
+      EXPECT_EQ( logMessageCount, static_cast<std::size_t>( std::count( output.begin(), output.end(), '\n' ) ) );
+    }
+  }
+
+  TEST( Cout, DirectTimer ) {
+
+    /* a lone record in a block buffer is written by the timer thread, without a next record or a flush */
+    testing::internal::CaptureStdout();
+    ConfigureLogger( { { "type", "std" }, { "mode", "direct" }, { "flush", "block" }, { "flush_interval", "50" } } );
+    LogWarning( logMessage );
+    std::this_thread::sleep_for( std::chrono::milliseconds( 500 ) );
+    const std::string output = testing::internal::GetCapturedStdout();
+    ConfigureLogger( { { "type", "" } } );
+
+    EXPECT_EQ( 1, std::count( output.begin(), output.end(), '\n' ) );
+  }
+
+  TEST( Cout, Routing ) {
+
+    /* the severity of the record decides, not the text of the message */
+    for ( const std::string mode : { "stream", "direct" } ) {
+
+      testing::internal::CaptureStdout();
+      testing::internal::CaptureStderr();
+      ConfigureLogger( { { "type", "std" }, { "mode", mode }, { "stderr", "true" } } );
+      LogInfo( "[ERROR] is only text" );
+      LogError( logMessage );
+      FlushLogger();
+      const std::string error = testing::internal::GetCapturedStderr();
+      const std::string output = testing::internal::GetCapturedStdout();
+      ConfigureLogger( { { "type", "" } } );
+
+      EXPECT_NE( std::string::npos, output.find( "[ERROR] is only text" ) );
+      EXPECT_EQ( std::string::npos, output.find( logMessage ) );
+      EXPECT_NE( std::string::npos, error.find( logMessage ) );
+      EXPECT_EQ( std::string::npos, error.find( "[ERROR] is only text" ) );
+    }
+  }
 }
 #ifdef __clang__
   #pragma clang diagnostic pop
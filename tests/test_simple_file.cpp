@@ -45,14 +45,25 @@
   #pragma clang diagnostic pop
 #endif
 
+/* system header */
+#ifdef HAVE_ZLIB
+  #include <zlib.h>
+#endif
+
 /* stl header */
+#include <algorithm>
+#include <array>
 #include <filesystem>
+#include <fstream>
+#include <regex>
+#include <thread>
 
 /* magic enum */
 #include <magic_enum.hpp>
 
 /* modern.cpp.logger */
 #include <LoggerFactory.h>
+#include <TimestampCache.h>
 
 /* local header */
 #include "shared/TestHelper.h"
@@ -110,6 +121,8 @@ namespace vx {
       LogVerbose( message );
     }
 
+    /* the file logger buffers, write everything before counting */
+    FlushLogger();
     const std::size_t count = TestHelper::countNewLines( tmpFile );
 
     if ( !std::filesystem::remove( tmpFile ) ) {
@@ -121,6 +134,403 @@ namespace vx {
     const std::size_t differentLogTypes = magic_enum::enum_count<Severity>() - magic_enum::enum_integer( avoidLogBelow );
     EXPECT_EQ( logMessageCount * differentLogTypes, count );
   }
+
+  TEST( File, Severity ) {
+
+    std::error_code errorCode {};
+    std::filesystem::path tmpPath = std::filesystem::temp_directory_path( errorCode );
+    if ( errorCode ) {
+
+      GTEST_FAIL() << "Error getting temp_directory_path: " + errorCode.message() + " Code: " + std::to_string( errorCode.value() );
+    }
+    tmpPath /= logFilename;
+    std::string tmpFile = tmpPath.string();
+
+    /* runtime threshold from configuration */
+    std::unique_ptr<Logger> logger = LoggerFactory::instance().produce( { { "type", "file" }, { "filename", tmpFile }, { "severity", "warning" } } );
+    EXPECT_EQ( std::max( Severity::Warning, avoidLogBelow ), logger->severity() );
+    for ( const auto severity : magic_enum::enum_values<Severity>() ) {
+
+      logger->log( logMessage, severity );
+    }
+
+    /* the compile time threshold stays as floor */
+    logger->setSeverity( Severity::Verbose );
+    EXPECT_EQ( avoidLogBelow, logger->severity() );
+    for ( const auto severity : magic_enum::enum_values<Severity>() ) {
+
+      logger->log( logMessage, severity );
+    }
+    logger.reset();
+
+    const std::size_t count = TestHelper::countNewLines( tmpFile );
+
+    if ( !std::filesystem::remove( tmpFile ) ) {
+
+      GTEST_FAIL() << "Tmp file cannot be removed: " + tmpFile;
+    }
+
+    const std::size_t severityCount = magic_enum::enum_count<Severity>();
+    const std::size_t warningTypes = severityCount - magic_enum::enum_integer( std::max( Severity::Warning, avoidLogBelow ) );
+    const std::size_t differentLogTypes = severityCount - magic_enum::enum_integer( avoidLogBelow );
+    EXPECT_EQ( warningTypes + differentLogTypes, count );
+  }
+
+  TEST( File, Flush ) {
+
+    std::error_code errorCode {};
+    std::filesystem::path tmpPath = std::filesystem::temp_directory_path( errorCode );
+    if ( errorCode ) {
+
+      GTEST_FAIL() << "Error getting temp_directory_path: " + errorCode.message() + " Code: " + std::to_string( errorCode.value() );
+    }
+    tmpPath /= logFilename;
+    std::string tmpFile = tmpPath.string();
+
+    /* records below the flush severity stay in the buffer */
+    std::unique_ptr<Logger> logger = LoggerFactory::instance().produce( { { "type", "file" }, { "filename", tmpFile }, { "flush_severity", "fatal" }, { "flush_interval", "3600000" } } );
+    logger->log( logMessage, Severity::Error );
+    logger->log( logMessage, Severity::Warning );
+    const std::size_t buffered = TestHelper::countNewLines( tmpFile );
+
+    /* a fatal record writes them together with itself */
+    logger->log( logMessage, Severity::Fatal );
+    const std::size_t severityFlushed = TestHelper::countNewLines( tmpFile );
+
+    logger->log( logMessage, Severity::Error );
+    logger->flush();
+    const std::size_t flushed = TestHelper::countNewLines( tmpFile );
+
+    /* without a buffer every record is written */
+    logger = LoggerFactory::instance().produce( { { "type", "file" }, { "filename", tmpFile }, { "buffer_size", "0" } } );
+    logger->log( logMessage, Severity::Warning );
+    const std::size_t unbuffered = TestHelper::countNewLines( tmpFile );
+    logger.reset();
+
+    if ( !std::filesystem::remove( tmpFile ) ) {
+
+      GTEST_FAIL() << "Tmp file cannot be removed: " + tmpFile;
+    }
+
+    EXPECT_EQ( 0, buffered );
+    EXPECT_EQ( 3, severityFlushed );
+    EXPECT_EQ( 4, flushed );
+    EXPECT_EQ( 5, unbuffered );
+    EXPECT_THROW( static_cast<void>( LoggerFactory::instance().produce( { { "type", "file" }, { "filename", tmpFile }, { "flush_severity", "loud" } } ) ), std::invalid_argument );
+  }
+
+  TEST( File, TimedFlush ) {
+
+    std::error_code errorCode {};
+    std::filesystem::path tmpPath = std::filesystem::temp_directory_path( errorCode );
+    if ( errorCode ) {
+
+      GTEST_FAIL() << "Error getting temp_directory_path: " + errorCode.message() + " Code: " + std::to_string( errorCode.value() );
+    }
+    tmpPath /= logFilename;
+    std::string tmpFile = tmpPath.string();
+
+    /* a lone record is written by the background thread, without a next record or a flush */
+    for ( const std::string mode : { "stream", "append" } ) {
+
+      std::unique_ptr<Logger> logger = LoggerFactory::instance().produce( { { "type", "file" }, { "filename", tmpFile }, { "mode", mode }, { "flush_interval", "50" } } );
+      logger->log( logMessage, Severity::Info );
+      std::this_thread::sleep_for( std::chrono::milliseconds( 500 ) );
+      const std::size_t written = TestHelper::countNewLines( tmpFile );
+      logger.reset();
+
+      std::filesystem::remove( tmpFile, errorCode );
+      EXPECT_EQ( 1, written ) << mode;
+    }
+  }
+
+  TEST( File, WithoutBackground ) {
+
+    std::error_code errorCode {};
+    std::filesystem::path tmpPath = std::filesystem::temp_directory_path( errorCode );
+    if ( errorCode ) {
+
+      GTEST_FAIL() << "Error getting temp_directory_path: " + errorCode.message() + " Code: " + std::to_string( errorCode.value() );
+    }
+    tmpPath /= logFilename;
+    std::string tmpFile = tmpPath.string();
+
+    /* nothing to rotate, reopen or flush later, the records are written without a background thread */
+    std::unique_ptr<Logger> logger = LoggerFactory::instance().produce( { { "type", "file" }, { "filename", tmpFile }, { "buffer_size", "0" }, { "reopen_interval", "0" } } );
+    logger->log( logMessage, Severity::Info );
+    const std::size_t written = TestHelper::countNewLines( tmpFile );
+    logger.reset();
+
+    std::filesystem::remove( tmpFile, errorCode );
+    EXPECT_EQ( 1, written );
+  }
+
+  TEST( File, Format ) {
+
+    std::error_code errorCode {};
+    std::filesystem::path tmpPath = std::filesystem::temp_directory_path( errorCode );
+    if ( errorCode ) {
+
+      GTEST_FAIL() << "Error getting temp_directory_path: " + errorCode.message() + " Code: " + std::to_string( errorCode.value() );
+    }
+    tmpPath /= logFilename;
+    std::string tmpFile = tmpPath.string();
+
+    ConfigureLogger( { { "type", "file" }, { "filename", tmpFile }, { "reopen_interval", "1" } } );
+    const std::string user( "user" );
+    LogFatal( "name={} id={} latency={:.2f}us", user, 42, 1.5 );
+    LogFatal( "id={} ok={}", 7, true );
+
+    /* the former logger closes the file */
+    ConfigureLogger( { { "type", "" } } );
+
+    std::ifstream stream( tmpFile );
+    const std::string content( ( std::istreambuf_iterator<char>( stream ) ), std::istreambuf_iterator<char>() );
+    stream.close();
+
+    if ( !std::filesystem::remove( tmpFile ) ) {
+
+      GTEST_FAIL() << "Tmp file cannot be removed: " + tmpFile;
+    }
+
+    EXPECT_NE( std::string::npos, content.find( "name=user id=42 latency=1.50us" ) );
+    EXPECT_NE( std::string::npos, content.find( "id=7 ok=true" ) );
+  }
+
+  TEST( File, Precision ) {
+
+    std::error_code errorCode {};
+    std::filesystem::path tmpPath = std::filesystem::temp_directory_path( errorCode );
+    if ( errorCode ) {
+
+      GTEST_FAIL() << "Error getting temp_directory_path: " + errorCode.message() + " Code: " + std::to_string( errorCode.value() );
+    }
+    tmpPath /= logFilename;
+    std::string tmpFile = tmpPath.string();
+
+    std::unique_ptr<Logger> logger = LoggerFactory::instance().produce( { { "type", "file" }, { "filename", tmpFile }, { "precision", "milliseconds" } } );
+    logger->log( logMessage, Severity::Fatal );
+    logger.reset();
+
+    std::ifstream stream( tmpFile );
+    std::string line {};
+    std::getline( stream, line );
+    stream.close();
+
+    if ( !std::filesystem::remove( tmpFile ) ) {
+
+      GTEST_FAIL() << "Tmp file cannot be removed: " + tmpFile;
+    }
+
+    EXPECT_TRUE( std::regex_search( line, std::regex( R"(^\d{4}-\d{2}-\d{2}T\d{2}:\d{2}:\d{2}\.\d{3}[+-]\d{2}:\d{2} \[FATAL\])" ) ) ) << line;
+
+    /* the cached fields match a fresh rendering over second and minute rollovers */
+    TimestampCache cache {};
+    auto time = std::chrono::system_clock::time_point( std::chrono::hours( 24 * 365 * 50 ) );
+    for ( int i = 0; i < 1000; ++i ) {
+
+      std::string cached {};
+      cache.append( cached, timestamp::Precision::NanoSeconds, time );
+      std::string fresh {};
+      TimestampCache().append( fresh, timestamp::Precision::NanoSeconds, time );
+      EXPECT_EQ( fresh, cached );
+      time += std::chrono::milliseconds( 333 );
+    }
+  }
+
+  TEST( File, Uring ) {
+
+    std::error_code errorCode {};
+    std::filesystem::path tmpPath = std::filesystem::temp_directory_path( errorCode );
+    if ( errorCode ) {
+
+      GTEST_FAIL() << "Error getting temp_directory_path: " + errorCode.message() + " Code: " + std::to_string( errorCode.value() );
+    }
+    tmpPath /= logFilename;
+    std::string tmpFile = tmpPath.string();
+
+    /* small buffers, so several of them are in flight, the order in the file is kept */
+    for ( const std::string fixed : { "true", "false" } ) {
+
+      std::unique_ptr<Logger> logger = LoggerFactory::instance().produce( { { "type", "file" }, { "filename", tmpFile }, { "mode", "uring" }, { "buffer_size", "256" }, { "uring_buffers", "2" }, { "uring_fixed", fixed } } );
+      for ( std::size_t i = 0; i < logMessageCount; ++i ) {
+
+        logger->log( std::to_string( i ), Severity::Info );
+      }
+      logger->flush();
+      const std::size_t count = TestHelper::countNewLines( tmpFile );
+      logger.reset();
+
+      std::ifstream stream( tmpFile );
+      std::size_t ordered = 0;
+      for ( std::string line {}; std::getline( stream, line ); ++ordered ) {
+
+        if ( !line.ends_with( " " + std::to_string( ordered ) ) ) {
+
+          break;
+        }
+      }
+      stream.close();
+
+      if ( !std::filesystem::remove( tmpFile ) ) {
+
+        GTEST_FAIL() << "Tmp file cannot be removed: " + tmpFile;
+      }
+
+      EXPECT_EQ( logMessageCount, count );
+      EXPECT_EQ( logMessageCount, ordered );
+    }
+    EXPECT_THROW( static_cast<void>( LoggerFactory::instance().produce( { { "type", "file" }, { "filename", tmpFile }, { "mode", "uring" }, { "uring_buffers", "0" } } ) ), std::invalid_argument );
+  }
+
+  TEST( File, UringTruncate ) {
+
+    std::error_code errorCode {};
+    std::filesystem::path tmpPath = std::filesystem::temp_directory_path( errorCode );
+    if ( errorCode ) {
+
+      GTEST_FAIL() << "Error getting temp_directory_path: " + errorCode.message() + " Code: " + std::to_string( errorCode.value() );
+    }
+    tmpPath /= logFilename;
+    std::string tmpFile = tmpPath.string();
+
+    /* copytruncate empties the file in place, the next records start at its new end without a hole */
+    std::unique_ptr<Logger> logger = LoggerFactory::instance().produce( { { "type", "file" }, { "filename", tmpFile }, { "mode", "uring" } } );
+    for ( std::size_t i = 0; i < 100; ++i ) {
+
+      logger->log( logMessage, Severity::Info );
+    }
+    logger->flush();
+
+    /* the background thread knows the size, before the file shrinks */
+    std::this_thread::sleep_for( std::chrono::milliseconds( 1500 ) );
+    std::filesystem::resize_file( tmpFile, 0 );
+    std::this_thread::sleep_for( std::chrono::milliseconds( 2500 ) );
+    logger->log( logMessage, Severity::Info );
+    logger->flush();
+    logger.reset();
+
+    std::string content {};
+    {
+      std::ifstream file( tmpFile, std::ifstream::binary );
+      content.assign( std::istreambuf_iterator<char>( file ), std::istreambuf_iterator<char>() );
+    }
+    std::filesystem::remove( tmpFile, errorCode );
+
+    EXPECT_EQ( 1, std::count( content.begin(), content.end(), '\n' ) );
+    EXPECT_EQ( std::string::npos, content.find( '\0' ) );
+  }
+
+  TEST( File, Rotate ) {
+
+    std::error_code errorCode {};
+    std::filesystem::path tmpPath = std::filesystem::temp_directory_path( errorCode );
+    if ( errorCode ) {
+
+      GTEST_FAIL() << "Error getting temp_directory_path: " + errorCode.message() + " Code: " + std::to_string( errorCode.value() );
+    }
+    tmpPath /= logFilename;
+    std::string tmpFile = tmpPath.string();
+
+    /* the background thread rotates, the oldest files above max_files are removed */
+    std::unique_ptr<Logger> logger = LoggerFactory::instance().produce( { { "type", "file" }, { "filename", tmpFile }, { "max_size", "4096" }, { "max_files", "2" } } );
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds( 5 );
+    while ( !std::filesystem::exists( tmpFile + ".2" ) && std::chrono::steady_clock::now() < deadline ) {
+
+      for ( std::size_t i = 0; i < 100; ++i ) {
+
+        logger->log( logMessage, Severity::Info );
+      }
+      logger->flush();
+      std::this_thread::sleep_for( std::chrono::milliseconds( 20 ) );
+    }
+    logger.reset();
+
+    const bool rotated = std::filesystem::exists( tmpFile + ".1" ) && std::filesystem::exists( tmpFile + ".2" );
+    const bool retained = !std::filesystem::exists( tmpFile + ".3" );
+    for ( const std::string suffix : { "", ".1", ".2", ".3" } ) {
+
+      std::filesystem::remove( tmpFile + suffix, errorCode );
+    }
+
+    EXPECT_TRUE( rotated );
+    EXPECT_TRUE( retained );
+  }
+
+  TEST( File, Reopen ) {
+
+    std::error_code errorCode {};
+    std::filesystem::path tmpPath = std::filesystem::temp_directory_path( errorCode );
+    if ( errorCode ) {
+
+      GTEST_FAIL() << "Error getting temp_directory_path: " + errorCode.message() + " Code: " + std::to_string( errorCode.value() );
+    }
+    tmpPath /= logFilename;
+    std::string tmpFile = tmpPath.string();
+    const std::string movedFile = tmpFile + ".moved";
+
+    /* an external logrotate moves the file away, the logger continues with a new one */
+    std::unique_ptr<Logger> logger = LoggerFactory::instance().produce( { { "type", "file" }, { "filename", tmpFile }, { "reopen_interval", "1" } } );
+    logger->log( logMessage, Severity::Info );
+    logger->flush();
+    std::filesystem::rename( tmpFile, movedFile );
+    std::this_thread::sleep_for( std::chrono::milliseconds( 2500 ) );
+    logger->log( logMessage, Severity::Info );
+    logger->flush();
+    logger.reset();
+
+    const std::size_t moved = TestHelper::countNewLines( movedFile );
+    const std::size_t reopened = TestHelper::countNewLines( tmpFile );
+    std::filesystem::remove( movedFile, errorCode );
+    std::filesystem::remove( tmpFile, errorCode );
+
+    EXPECT_EQ( 1, moved );
+    EXPECT_EQ( 1, reopened );
+  }
+
+  TEST( File, Compression ) {
+
+    std::error_code errorCode {};
+    std::filesystem::path tmpPath = std::filesystem::temp_directory_path( errorCode );
+    if ( errorCode ) {
+
+      GTEST_FAIL() << "Error getting temp_directory_path: " + errorCode.message() + " Code: " + std::to_string( errorCode.value() );
+    }
+    tmpPath /= logFilename;
+    std::string tmpFile = tmpPath.string();
+
+    EXPECT_THROW( static_cast<void>( LoggerFactory::instance().produce( { { "type", "file" }, { "filename", tmpFile }, { "compression", "rar" } } ) ), std::invalid_argument );
+    EXPECT_THROW( static_cast<void>( LoggerFactory::instance().produce( { { "type", "file" }, { "filename", tmpFile }, { "compression_mode", "inline" } } ) ), std::invalid_argument );
+
+#ifdef HAVE_ZLIB
+    EXPECT_THROW( static_cast<void>( LoggerFactory::instance().produce( { { "type", "file" }, { "filename", tmpFile }, { "compression", "gzip" }, { "mode", "append" } } ) ), std::invalid_argument );
+
+    /* small frames, zlib reads the concatenated gzip members as one stream */
+    std::unique_ptr<Logger> logger = LoggerFactory::instance().produce( { { "type", "file" }, { "filename", tmpFile }, { "compression", "gzip" }, { "buffer_size", "1024" } } );
+    for ( std::size_t i = 0; i < logMessageCount; ++i ) {
+
+      logger->log( logMessage, Severity::Info );
+    }
+    logger.reset();
+
+    std::size_t count = 0;
+    gzFile file = gzopen( tmpFile.c_str(), "rb" );
+    ASSERT_NE( nullptr, file );
+    std::array<char, 4096> chunk {};
+    for ( int read = gzread( file, chunk.data(), static_cast<unsigned int>( chunk.size() ) ); read > 0; read = gzread( file, chunk.data(), static_cast<unsigned int>( chunk.size() ) ) ) {
+
+      count += static_cast<std::size_t>( std::count( chunk.data(), chunk.data() + read, '\n' ) );
+    }
+    gzclose( file );
+
+    if ( !std::filesystem::remove( tmpFile ) ) {
+
+      GTEST_FAIL() << "Tmp file cannot be removed: " + tmpFile;
+    }
+
+    EXPECT_EQ( logMessageCount, count );
+#endif
+  }
 }
 #ifdef __clang__
   #pragma clang diagnostic pop
@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2021 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* cppunit header */
+#ifdef __clang__
+  #pragma clang diagnostic push
+  #pragma clang diagnostic ignored "-Weverything"
+#endif
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Weffc++"
+#endif
+#include <gtest/gtest.h>
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif
+#ifdef __clang__
+  #pragma clang diagnostic pop
+#endif
+
+/* stl header */
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+/* magic enum */
+#include <magic_enum.hpp>
+
+/* modern.cpp.logger */
+#include <Escape.h>
+#include <LoggerFactory.h>
+
+/* local header */
+#include "shared/TestHelper.h"
+
+using ::testing::InitGoogleTest;
+using ::testing::Test;
+
+/**
+ * @brief Filename of temporary log file.
+ */
+constexpr std::string_view logFilename = "test.log";
+
+/**
+ * @brief Count of log messages per thread.
+ */
+constexpr std::size_t logMessageCount = 10000;
+
+/**
+ * @brief Log message itself.
+ */
+constexpr std::string_view logMessage = "This is a log message";
+
+#ifdef __clang__
+  #pragma clang diagnostic push
+  #pragma clang diagnostic ignored "-Wglobal-constructors"
+#endif
+namespace vx {
+
+  TEST( Json, Simple ) {
+
+    std::error_code errorCode {};
+    std::filesystem::path tmpPath = std::filesystem::temp_directory_path( errorCode );
+    if ( errorCode ) {
+
+      GTEST_FAIL() << "Error getting temp_directory_path: " + errorCode.message() + " Code: " + std::to_string( errorCode.value() );
+    }
+    tmpPath /= logFilename;
+    std::string tmpFile = tmpPath.string();
+    std::cout << tmpFile << std::endl;
+
+    /* configure logging, if you dont do, it defaults to standard out logging with colors */
+    ConfigureLogger( { { "type", "json" }, { "filename", tmpFile }, { "reopen_interval", "1" } } );
+
+    std::ostringstream sstream;
+    sstream << logMessage;
+
+    const std::string message = sstream.str();
+    for ( std::size_t i = 0; i < logMessageCount; ++i ) {
+
+      LogFatal( message );
+      LogError( message );
+      LogWarning( message );
+      LogInfo( message );
+      LogDebug( message );
+      LogVerbose( message );
+    }
+
+    /* the file logger buffers, write everything before counting */
+    FlushLogger();
+    const std::size_t count = TestHelper::countNewLines( tmpFile );
+
+    if ( !std::filesystem::remove( tmpFile ) ) {
+
+      GTEST_FAIL() << "Tmp file cannot be removed: " + tmpFile;
+    }
+
+    /* Count Severity enum and remove entries we are avoid to log */
+    const std::size_t differentLogTypes = magic_enum::enum_count<Severity>() - magic_enum::enum_integer( avoidLogBelow );
+    EXPECT_EQ( logMessageCount * differentLogTypes, count );
+  }
+
+  TEST( Json, Raw ) {
+
+    std::error_code errorCode {};
+    std::filesystem::path tmpPath = std::filesystem::temp_directory_path( errorCode );
+    if ( errorCode ) {
+
+      GTEST_FAIL() << "Error getting temp_directory_path: " + errorCode.message() + " Code: " + std::to_string( errorCode.value() );
+    }
+    tmpPath /= logFilename;
+    std::string tmpFile = tmpPath.string();
+
+    /* an already built message becomes an object, it never writes plain text into the json lines */
+    std::unique_ptr<Logger> logger = LoggerFactory::instance().produce( { { "type", "json" }, { "filename", tmpFile } } );
+    logger->log( std::string_view( "raw \"text\"\n" ) );
+    logger.reset();
+
+    std::ifstream stream( tmpFile );
+    const std::string content( ( std::istreambuf_iterator<char>( stream ) ), std::istreambuf_iterator<char>() );
+    stream.close();
+    if ( !std::filesystem::remove( tmpFile ) ) {
+
+      GTEST_FAIL() << "Tmp file cannot be removed: " + tmpFile;
+    }
+
+    EXPECT_TRUE( content.starts_with( "{\"timestamp\":\"" ) );
+    EXPECT_TRUE( content.ends_with( "\",\"message\":\"raw \\\"text\\\"\"}\n" ) );
+    EXPECT_EQ( 1, std::count( content.begin(), content.end(), '\n' ) );
+  }
+
+  TEST( Json, Escape ) {
+
+    std::error_code errorCode {};
+    std::filesystem::path tmpPath = std::filesystem::temp_directory_path( errorCode );
+    if ( errorCode ) {
+
+      GTEST_FAIL() << "Error getting temp_directory_path: " + errorCode.message() + " Code: " + std::to_string( errorCode.value() );
+    }
+    tmpPath /= logFilename;
+    std::string tmpFile = tmpPath.string();
+    std::cout << tmpFile << std::endl;
+
+    std::unique_ptr<Logger> logger = LoggerFactory::instance().produce( { { "type", "json" }, { "filename", tmpFile } } );
+    logger->log( "path \"C:\\tmp\"\nnext\tline \x1b[0m", Severity::Warning );
+    logger->log( LogRecord { Severity::Error, {}, nullptr, "no location", nullptr, {} } );
+    logger.reset();
+
+    std::ifstream stream( tmpFile );
+    std::string first {};
+    std::string second {};
+    std::getline( stream, first );
+    std::getline( stream, second );
+    stream.close();
+    if ( !std::filesystem::remove( tmpFile ) ) {
+
+      GTEST_FAIL() << "Tmp file cannot be removed: " + tmpFile;
+    }
+
+    /* one object per line with the keys in order */
+    EXPECT_EQ( 0, first.find( "{\"timestamp\":\"" ) );
+    EXPECT_NE( std::string::npos, first.find( "\",\"severity\":\"WARNING\",\"file\":\"" ) );
+    EXPECT_NE( std::string::npos, first.find( "\",\"line\":" ) );
+    EXPECT_NE( std::string::npos, first.find( ",\"function\":\"" ) );
+    const std::string_view end = "\",\"message\":\"path \\\"C:\\\\tmp\\\"\\nnext\\tline \\u001b[0m\"}";
+    EXPECT_EQ( end, std::string_view( first ).substr( first.size() - std::min( first.size(), end.size() ) ) );
+    EXPECT_NE( std::string::npos, second.find( "\",\"severity\":\"ERROR\",\"message\":\"no location\"}" ) );
+    EXPECT_EQ( std::string::npos, second.find( "\"file\"" ) );
+  }
+
+  TEST( Json, EscapeBlocks ) {
+
+    /* reference, one character after the other */
+    const auto reference = []( std::string_view _text ) {
+      std::string output {};
+      for ( const char character : _text ) {
+
+        switch ( character ) {
+
+          case '"':
+            output.append( "\\\"" );
+            break;
+          case '\\':
+            output.append( "\\\\" );
+            break;
+          case '\n':
+            output.append( "\\n" );
+            break;
+          case '\x01':
+            output.append( "\\u0001" );
+            break;
+          case '\x1f':
+            output.append( "\\u001f" );
+            break;
+          default:
+            output.push_back( character );
+            break;
+        }
+      }
+      return output;
+    };
+
+    /* every special character at every position of the 16 and 32 byte blocks and their tails */
+    constexpr std::string_view specials = "\"\\\n\x01\x1f";
+    for ( std::size_t size = 0; size <= 80; ++size ) {
+
+      for ( std::size_t position = 0; position <= size; ++position ) {
+
+        std::string text( size, '\xC3' );
+        for ( std::size_t i = 0; i < size; i += 2 ) {
+
+          text[ i ] = static_cast<char>( 'a' + i % 26 );
+        }
+        if ( position < size ) {
+
+          text[ position ] = specials[ ( size + position ) % specials.size() ];
+        }
+        std::string output = "prefix";
+        escape::appendJson( output, text );
+        EXPECT_EQ( "prefix" + reference( text ), output ) << "size " << size << " position " << position;
+      }
+    }
+  }
+}
+#ifdef __clang__
+  #pragma clang diagnostic pop
+#endif
+
+int main( int argc, char **argv ) {
+
+  InitGoogleTest( &argc, argv );
+  return RUN_ALL_TESTS();
+}
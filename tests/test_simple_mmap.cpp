@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2021 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* cppunit header */
+#ifdef __clang__
+  #pragma clang diagnostic push
+  #pragma clang diagnostic ignored "-Weverything"
+#endif
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Weffc++"
+#endif
+#include <gtest/gtest.h>
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif
+#ifdef __clang__
+  #pragma clang diagnostic pop
+#endif
+/* stl header */
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+/* magic enum */
+#include <magic_enum.hpp>
+
+/* modern.cpp.logger */
+#include <LoggerFactory.h>
+
+/* local header */
+#include "shared/TestHelper.h"
+
+using ::testing::InitGoogleTest;
+using ::testing::Test;
+
+/**
+ * @brief Filename of temporary log file.
+ */
+constexpr std::string_view logFilename = "test-mmap.log";
+
+/**
+ * @brief Count of log messages.
+ */
+constexpr std::size_t logMessageCount = 10000;
+
+/**
+ * @brief Log message itself.
+ */
+constexpr std::string_view logMessage = "This is a log message";
+
+#ifdef __clang__
+  #pragma clang diagnostic push
+  #pragma clang diagnostic ignored "-Wglobal-constructors"
+#endif
+namespace vx {
+
+  /**
+   * @brief All segments of the log file.
+   * @param _filename   Log file.
+   * @return The filename and the rolled segments, a preallocated segment, that was never used, leaves a gap in the numbers.
+   */
+  static std::vector<std::string> segmentFiles( const std::string &_filename ) {
+
+    std::vector<std::string> files {};
+    const std::filesystem::path path( _filename );
+    const std::string prefix = path.filename().string() + ".";
+    const auto numbered = [ &prefix ]( const std::string &_name ) {
+      return _name.size() > prefix.size() && _name.starts_with( prefix ) && std::all_of( _name.begin() + static_cast<std::ptrdiff_t>( prefix.size() ), _name.end(), []( char _character ) { return _character >= '0' && _character <= '9'; } );
+    };
+    std::error_code errorCode {};
+    for ( const auto &entry : std::filesystem::directory_iterator( path.parent_path(), errorCode ) ) {
+
+      const std::string name = entry.path().filename().string();
+      if ( name == path.filename().string() || numbered( name ) ) {
+
+        files.push_back( entry.path().string() );
+      }
+    }
+    return files;
+  }
+
+  /**
+   * @brief Check, that no preallocated tail is left in the file.
+   * @param _filename   Log file.
+   * @return True, if the file contains no zero bytes and ends with a newline.
+   */
+  static bool truncated( const std::string &_filename ) {
+
+    std::ifstream file( _filename, std::ifstream::binary );
+    const std::string content( ( std::istreambuf_iterator<char>( file ) ), std::istreambuf_iterator<char>() );
+    return !content.empty() && content.back() == '\n' && content.find( '\0' ) == std::string::npos;
+  }
+
+  TEST( Mmap, Simple ) {
+
+    std::error_code errorCode {};
+    std::filesystem::path tmpPath = std::filesystem::temp_directory_path( errorCode );
+    if ( errorCode ) {
+
+      GTEST_FAIL() << "Error getting temp_directory_path: " + errorCode.message() + " Code: " + std::to_string( errorCode.value() );
+    }
+    tmpPath /= logFilename;
+    std::string tmpFile = tmpPath.string();
+    std::cout << tmpFile << std::endl;
+
+    ConfigureLogger( { { "type", "mmap" }, { "filename", tmpFile } } );
+    for ( std::size_t i = 0; i < logMessageCount; ++i ) {
+
+      LogFatal( logMessage );
+      LogError( logMessage );
+      LogWarning( logMessage );
+      LogInfo( logMessage );
+      LogDebug( logMessage );
+      LogVerbose( logMessage );
+    }
+
+    /* records are visible without a flush */
+    const std::size_t count = TestHelper::countNewLines( tmpFile );
+
+    /* closing truncates the preallocated tail */
+    ConfigureLogger( { { "type", "" } } );
+    const std::vector<std::string> files = segmentFiles( tmpFile );
+    const bool clean = truncated( tmpFile );
+
+    for ( const auto &file : files ) {
+
+      if ( !std::filesystem::remove( file ) ) {
+
+        GTEST_FAIL() << "Tmp file cannot be removed: " + file;
+      }
+    }
+
+    /* Count Severity enum and remove entries we are avoid to log */
+    const std::size_t differentLogTypes = magic_enum::enum_count<Severity>() - magic_enum::enum_integer( avoidLogBelow );
+    EXPECT_EQ( logMessageCount * differentLogTypes, count );
+    EXPECT_EQ( 1, files.size() );
+    EXPECT_TRUE( clean );
+  }
+
+  TEST( Mmap, Roll ) {
+
+    std::error_code errorCode {};
+    std::filesystem::path tmpPath = std::filesystem::temp_directory_path( errorCode );
+    if ( errorCode ) {
+
+      GTEST_FAIL() << "Error getting temp_directory_path: " + errorCode.message() + " Code: " + std::to_string( errorCode.value() );
+    }
+    tmpPath /= logFilename;
+    std::string tmpFile = tmpPath.string();
+
+    /* small segments roll often, a record larger than a segment gets its own */
+    std::unique_ptr<Logger> logger = LoggerFactory::instance().produce( { { "type", "mmap" }, { "filename", tmpFile }, { "segment_size", "4096" } } );
+    for ( std::size_t i = 0; i < logMessageCount; ++i ) {
+
+      logger->log( logMessage, Severity::Fatal );
+    }
+    logger->log( std::string( 10000, 'x' ), Severity::Fatal );
+    logger.reset();
+
+    const std::vector<std::string> files = segmentFiles( tmpFile );
+    std::size_t count = 0;
+    bool clean = true;
+    for ( const auto &file : files ) {
+
+      count += TestHelper::countNewLines( file );
+      clean = clean && truncated( file );
+      if ( !std::filesystem::remove( file ) ) {
+
+        GTEST_FAIL() << "Tmp file cannot be removed: " + file;
+      }
+    }
+
+    EXPECT_EQ( logMessageCount + 1, count );
+    EXPECT_LT( 1, files.size() );
+    EXPECT_TRUE( clean );
+  }
+
+  TEST( Mmap, Invalid ) {
+
+    EXPECT_THROW( static_cast<void>( LoggerFactory::instance().produce( { { "type", "mmap" }, { "filename", "test-mmap.log" }, { "segment_size", "0" } } ) ), std::invalid_argument );
+    EXPECT_THROW( static_cast<void>( LoggerFactory::instance().produce( { { "type", "mmap" }, { "filename", "test-mmap.log" }, { "mode", "unknown" } } ) ), std::invalid_argument );
+  }
+
+  TEST( Mmap, Unsupported ) {
+
+    std::error_code errorCode {};
+    std::filesystem::path tmpPath = std::filesystem::temp_directory_path( errorCode );
+    if ( errorCode ) {
+
+      GTEST_FAIL() << "Error getting temp_directory_path: " + errorCode.message() + " Code: " + std::to_string( errorCode.value() );
+    }
+    tmpPath /= logFilename;
+    std::string tmpFile = tmpPath.string();
+
+    /* the keys of the file logger, that segments ignore, are named */
+    testing::internal::CaptureStdout();
+    std::unique_ptr<Logger> logger = LoggerFactory::instance().produce( { { "type", "mmap" }, { "filename", tmpFile }, { "mode", "append" }, { "max_size", "4096" }, { "compression_mode", "rotated" } } );
+    const std::string output = testing::internal::GetCapturedStdout();
+    logger.reset();
+    for ( const auto &file : segmentFiles( tmpFile ) ) {
+
+      std::filesystem::remove( file, errorCode );
+    }
+
+    EXPECT_NE( std::string::npos, output.find( "File mode append is not supported by the mmap logger, using the mapped segments." ) );
+    EXPECT_NE( std::string::npos, output.find( "max_size is not supported by the mmap logger and is ignored." ) );
+    EXPECT_NE( std::string::npos, output.find( "compression_mode is not supported by the mmap logger and is ignored." ) );
+  }
+}
+#ifdef __clang__
+  #pragma clang diagnostic pop
+#endif
+
+int main( int argc, char **argv ) {
+
+  InitGoogleTest( &argc, argv );
+  return RUN_ALL_TESTS();
+}
@@ -97,6 +97,72 @@ namespace vx {
 
     EXPECT_TRUE( true );
   }
+
+  TEST( Null, Lazy ) {
+
+    ConfigureLogger( { { "type", "" } } );
+    SetLogSeverity( Severity::Fatal );
+
+    /* filtered messages are never built */
+    std::size_t calls = 0;
+    LogError( [ &calls ] { ++calls; return std::string( logMessage ); } );
+    VX_LOG_ERROR( "{} {}", logMessage, ++calls );
+    EXPECT_EQ( 0, calls );
+
+    LogFatal( [ &calls ] { ++calls; return std::string( logMessage ); } );
+    VX_LOG_FATAL( "{} {}", logMessage, ++calls );
+    const std::size_t fatalCalls = avoidLogBelow <= Severity::Fatal ? 2 : 0;
+    EXPECT_EQ( fatalCalls, calls );
+  }
+
+  TEST( Null, SetSeverity ) {
+
+    ConfigureLogger( { { "type", "" } } );
+    SetLogSeverity( Severity::Fatal );
+    EXPECT_FALSE( IsLogEnabled( Severity::Error ) );
+
+    /* the setter of the installed logger updates the pre-check */
+    logger().setSeverity( Severity::Error );
+    EXPECT_EQ( avoidLogBelow <= Severity::Error, IsLogEnabled( Severity::Error ) );
+    EXPECT_FALSE( IsLogEnabled( Severity::Warning ) );
+
+    /* another logger does not */
+    std::unique_ptr<Logger> other = LoggerFactory::instance().produce( { { "type", "" } } );
+    other->setSeverity( Severity::Fatal );
+    EXPECT_EQ( avoidLogBelow <= Severity::Error, IsLogEnabled( Severity::Error ) );
+    SetLogSeverity( Severity::Verbose );
+  }
+
+  TEST( Null, CallSites ) {
+
+    ConfigureLogger( { { "type", "" } } );
+    SetLogSeverity( Severity::Fatal );
+
+    /* every site is registered once, no matter how often it logs */
+    const std::size_t before = CallSiteRegistry::instance().size();
+    const std::uint_least32_t line = std::source_location::current().line();
+    for ( std::size_t i = 0; i < logMessageCount; ++i ) {
+
+      LogFatal( "{} #{}", logMessage, i );
+      LogFatal( logMessage );
+    }
+    EXPECT_EQ( before + 2, CallSiteRegistry::instance().size() );
+
+    const std::vector<CallSiteInfo> sites = CallSiteRegistry::instance().sites();
+    ASSERT_EQ( before + 2, sites.size() );
+    EXPECT_EQ( "{} #{}", sites[ before ].format );
+    EXPECT_EQ( line + 3, sites[ before ].location.line() );
+    EXPECT_EQ( Severity::Fatal, sites[ before ].severity );
+    EXPECT_TRUE( sites[ before + 1 ].format.empty() );
+    EXPECT_EQ( line + 4, sites[ before + 1 ].location.line() );
+    EXPECT_EQ( "test_simple_null.cpp", sites[ before + 1 ].location.basename() );
+
+    /* the ids resolve to the same sites */
+    for ( const CallSiteInfo &site : sites ) {
+
+      EXPECT_EQ( site.location.line(), CallSiteRegistry::instance().site( site.location.site() ).location.line() );
+    }
+  }
 }
 #ifdef __clang__
   #pragma clang diagnostic pop
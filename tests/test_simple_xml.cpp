@@ -46,12 +46,15 @@
 #endif
 
 /* stl header */
+#include <algorithm>
 #include <filesystem>
+#include <fstream>
 
 /* magic enum */
 #include <magic_enum.hpp>
 
 /* modern.cpp.logger */
+#include <Escape.h>
 #include <LoggerFactory.h>
 
 /* local header */
@@ -81,6 +84,25 @@ constexpr std::string_view logMessage = "This is a log message";
 #endif
 namespace vx {
 
+  /**
+   * @brief Logs from its comparison operator.
+   */
+  struct Compared {
+
+    /** Logger */
+    Logger *logger = nullptr;
+
+    /**
+     * @brief Log a message with special characters.
+     * @return Always false.
+     */
+    bool operator<( const Compared & ) const {
+
+      logger->log( "a < b && c > d \x1b[0m\tend", Severity::Info );
+      return false;
+    }
+  };
+
   TEST( Xml, Simple ) {
 
     std::error_code errorCode {};
@@ -110,6 +132,8 @@ namespace vx {
       LogVerbose( message );
     }
 
+    /* the file logger buffers, write everything before counting */
+    FlushLogger();
     const std::size_t count = TestHelper::countNewLines( tmpFile );
 
     if ( !std::filesystem::remove( tmpFile ) ) {
@@ -121,6 +145,117 @@ namespace vx {
     const std::size_t differentLogTypes = magic_enum::enum_count<Severity>() - magic_enum::enum_integer( avoidLogBelow );
     EXPECT_EQ( logMessageCount * differentLogTypes, count );
   }
+  TEST( Xml, Escape ) {
+
+    std::error_code errorCode {};
+    std::filesystem::path tmpPath = std::filesystem::temp_directory_path( errorCode );
+    if ( errorCode ) {
+
+      GTEST_FAIL() << "Error getting temp_directory_path: " + errorCode.message() + " Code: " + std::to_string( errorCode.value() );
+    }
+    tmpPath /= logFilename;
+    std::string tmpFile = tmpPath.string();
+    std::cout << tmpFile << std::endl;
+
+    std::unique_ptr<Logger> logger = LoggerFactory::instance().produce( { { "type", "xml" }, { "filename", tmpFile } } );
+    /* the function name of a comparison operator contains an angle bracket */
+    const Compared compared { logger.get() };
+    EXPECT_FALSE( compared < compared );
+    logger.reset();
+
+    std::ifstream stream( tmpFile );
+    const std::string content( ( std::istreambuf_iterator<char>( stream ) ), std::istreambuf_iterator<char>() );
+    stream.close();
+    if ( !std::filesystem::remove( tmpFile ) ) {
+
+      GTEST_FAIL() << "Tmp file cannot be removed: " + tmpFile;
+    }
+
+    EXPECT_NE( std::string::npos, content.find( "<message>a &lt; b &amp;&amp; c &gt; d \xEF\xBF\xBD[0m\tend</message>" ) );
+#ifdef __GNUC__
+    EXPECT_NE( std::string::npos, content.find( "<function>operator&lt;</function>" ) );
+#endif
+  }
+
+  TEST( Xml, Raw ) {
+
+    std::error_code errorCode {};
+    std::filesystem::path tmpPath = std::filesystem::temp_directory_path( errorCode );
+    if ( errorCode ) {
+
+      GTEST_FAIL() << "Error getting temp_directory_path: " + errorCode.message() + " Code: " + std::to_string( errorCode.value() );
+    }
+    tmpPath /= logFilename;
+    std::string tmpFile = tmpPath.string();
+
+    /* an already built message becomes an entry, it never writes plain text into the xml */
+    std::unique_ptr<Logger> logger = LoggerFactory::instance().produce( { { "type", "xml" }, { "filename", tmpFile } } );
+    logger->log( std::string_view( "raw <text> & more\n" ) );
+    logger.reset();
+
+    std::ifstream stream( tmpFile );
+    const std::string content( ( std::istreambuf_iterator<char>( stream ) ), std::istreambuf_iterator<char>() );
+    stream.close();
+    if ( !std::filesystem::remove( tmpFile ) ) {
+
+      GTEST_FAIL() << "Tmp file cannot be removed: " + tmpFile;
+    }
+
+    EXPECT_TRUE( content.starts_with( "<entry><timestamp>" ) );
+    EXPECT_TRUE( content.ends_with( "</timestamp><message>raw &lt;text&gt; &amp; more</message></entry>\n" ) );
+    EXPECT_EQ( 1, std::count( content.begin(), content.end(), '\n' ) );
+  }
+
+  TEST( Xml, EscapeBlocks ) {
+
+    /* reference, one character after the other */
+    const auto reference = []( std::string_view _text ) {
+      std::string output {};
+      for ( const char character : _text ) {
+
+        switch ( character ) {
+
+          case '&':
+            output.append( "&amp;" );
+            break;
+          case '<':
+            output.append( "&lt;" );
+            break;
+          case '>':
+            output.append( "&gt;" );
+            break;
+          case '\x01':
+            output.append( "\xEF\xBF\xBD" );
+            break;
+          default:
+            output.push_back( character );
+            break;
+        }
+      }
+      return output;
+    };
+
+    /* every special character at every position of the 16 and 32 byte blocks and their tails */
+    constexpr std::string_view specials = "&<>\x01\n";
+    for ( std::size_t size = 0; size <= 80; ++size ) {
+
+      for ( std::size_t position = 0; position <= size; ++position ) {
+
+        std::string text( size, '\xC3' );
+        for ( std::size_t i = 0; i < size; i += 2 ) {
+
+          text[ i ] = static_cast<char>( 'a' + i % 26 );
+        }
+        if ( position < size ) {
+
+          text[ position ] = specials[ ( size + position ) % specials.size() ];
+        }
+        std::string output = "prefix";
+        escape::appendXml( output, text );
+        EXPECT_EQ( "prefix" + reference( text ), output ) << "size " << size << " position " << position;
+      }
+    }
+  }
 }
 #ifdef __clang__
   #pragma clang diagnostic pop
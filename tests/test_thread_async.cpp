@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* cppunit header */
+#ifdef __clang__
+  #pragma clang diagnostic push
+  #pragma clang diagnostic ignored "-Weverything"
+#endif
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Weffc++"
+#endif
+#include <gtest/gtest.h>
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif
+#ifdef __clang__
+  #pragma clang diagnostic pop
+#endif
+
+/* stl header */
+#include <chrono>
+#include <filesystem>
+#include <thread>
+
+/* magic enum */
+#include <magic_enum.hpp>
+
+/* modern.cpp.logger */
+#include <LoggerFactory.h>
+
+/* local header */
+#include "shared/TestHelper.h"
+
+using ::testing::InitGoogleTest;
+using ::testing::Test;
+
+/**
+ * @brief Filename of temporary log file.
+ */
+constexpr std::string_view logFilename = "test.log";
+
+/**
+ * @brief Count of log messages per thread.
+ */
+constexpr std::size_t logMessageCount = 10000;
+
+/**
+ * @brief Log message itself.
+ */
+constexpr std::string_view logMessage = "This is a log message";
+
+#ifdef __clang__
+  #pragma clang diagnostic push
+  #pragma clang diagnostic ignored "-Wglobal-constructors"
+#endif
+namespace vx {
+
+  /**
+   * @brief Log from all hardware threads and count the written lines.
+   * @param _configuration   Logger configuration, without filename.
+   * @param _filename   Log file.
+   * @return Pair of expected and written lines.
+   */
+  static std::pair<std::size_t, std::size_t> logFromThreads( std::unordered_map<std::string, std::string> _configuration,
+                                                             const std::string &_filename ) {
+
+    /* the async logger writes all pending messages, when it is destroyed */
+    _configuration[ "filename" ] = _filename;
+    std::unique_ptr<Logger> logger = LoggerFactory::instance().produce( _configuration );
+
+    unsigned int hardwareThreadCount = std::max<unsigned int>( 1, std::thread::hardware_concurrency() );
+
+#if defined __GNUC__ && __GNUC__ >= 10 || defined _MSC_VER && _MSC_VER >= 1928
+    std::vector<std::jthread> threads {};
+    threads.reserve( hardwareThreadCount );
+    for ( unsigned int n = 0; n < hardwareThreadCount; ++n ) {
+
+      threads.emplace_back( std::jthread( [ &hardwareThreadCount, &logger ] {
+        for ( std::size_t i = 0; i < logMessageCount / hardwareThreadCount; ++i ) {
+
+          logger->log( logMessage, Severity::Fatal );
+          logger->log( logMessage, Severity::Error );
+          logger->log( logMessage, Severity::Warning );
+          logger->log( logMessage, Severity::Info );
+          logger->log( logMessage, Severity::Debug );
+          logger->log( logMessage, Severity::Verbose );
+        }
+      } ) );
+    }
+#else
+    std::vector<std::thread> threads {};
+    threads.reserve( hardwareThreadCount );
+    for ( unsigned int n = 0; n < hardwareThreadCount; ++n ) {
+
+      threads.emplace_back( std::thread( [ &hardwareThreadCount, &logger ] {
+        for ( std::size_t i = 0; i < logMessageCount / hardwareThreadCount; ++i ) {
+
+          logger->log( logMessage, Severity::Fatal );
+          logger->log( logMessage, Severity::Error );
+          logger->log( logMessage, Severity::Warning );
+          logger->log( logMessage, Severity::Info );
+          logger->log( logMessage, Severity::Debug );
+          logger->log( logMessage, Severity::Verbose );
+        }
+      } ) );
+    }
+#endif
+    for ( auto &thread : threads ) {
+
+      thread.join();
+    }
+    threads.clear();
+    logger.reset();
+
+    /* Count Severity enum and remove entries we are avoid to log */
+    const std::size_t differentLogTypes = magic_enum::enum_count<Severity>() - magic_enum::enum_integer( avoidLogBelow );
+    return { logMessageCount / hardwareThreadCount * hardwareThreadCount * differentLogTypes, TestHelper::countNewLines( _filename ) };
+  }
+
+  TEST( AsyncT, Thread ) {
+
+    std::error_code errorCode {};
+    std::filesystem::path tmpPath = std::filesystem::temp_directory_path( errorCode );
+    if ( errorCode ) {
+
+      GTEST_FAIL() << "Error getting temp_directory_path: " + errorCode.message() + " Code: " + std::to_string( errorCode.value() );
+    }
+    tmpPath /= logFilename;
+    std::string tmpFile = tmpPath.string();
+    std::cout << tmpFile << std::endl;
+
+    const auto [ expected, count ] = logFromThreads( { { "type", "async" }, { "sink", "file" }, { "reopen_interval", "1" }, { "queue_capacity", "1024" } }, tmpFile );
+
+    if ( !std::filesystem::remove( tmpFile ) ) {
+
+      GTEST_FAIL() << "Tmp file cannot be removed: " + tmpFile;
+    }
+
+    EXPECT_EQ( expected, count );
+  }
+
+  TEST( AsyncT, ThreadQueues ) {
+
+    std::error_code errorCode {};
+    std::filesystem::path tmpPath = std::filesystem::temp_directory_path( errorCode );
+    if ( errorCode ) {
+
+      GTEST_FAIL() << "Error getting temp_directory_path: " + errorCode.message() + " Code: " + std::to_string( errorCode.value() );
+    }
+    tmpPath /= logFilename;
+    std::string tmpFile = tmpPath.string();
+    std::cout << tmpFile << std::endl;
+
+    const auto [ expected, count ] = logFromThreads( { { "type", "async" }, { "sink", "file" }, { "reopen_interval", "1" }, { "queue_capacity", "1024" }, { "queue", "thread" } }, tmpFile );
+
+    if ( !std::filesystem::remove( tmpFile ) ) {
+
+      GTEST_FAIL() << "Tmp file cannot be removed: " + tmpFile;
+    }
+
+    EXPECT_EQ( expected, count );
+  }
+
+  TEST( AsyncT, ThreadQueuesFull ) {
+
+    std::error_code errorCode {};
+    std::filesystem::path tmpPath = std::filesystem::temp_directory_path( errorCode );
+    if ( errorCode ) {
+
+      GTEST_FAIL() << "Error getting temp_directory_path: " + errorCode.message() + " Code: " + std::to_string( errorCode.value() );
+    }
+    tmpPath /= logFilename;
+    std::string tmpFile = tmpPath.string();
+    std::cout << tmpFile << std::endl;
+
+    /* a full queue wakes up the backend, it does not sleep for the whole wake-up interval */
+    const auto start = std::chrono::steady_clock::now();
+    const auto [ expected, count ] = logFromThreads( { { "type", "async" }, { "sink", "file" }, { "reopen_interval", "1" }, { "queue_capacity", "4" }, { "queue", "thread" }, { "wakeup_interval", "60000" } }, tmpFile );
+    const auto duration = std::chrono::steady_clock::now() - start;
+
+    if ( !std::filesystem::remove( tmpFile ) ) {
+
+      GTEST_FAIL() << "Tmp file cannot be removed: " + tmpFile;
+    }
+
+    EXPECT_EQ( expected, count );
+    EXPECT_LT( duration, std::chrono::seconds( 30 ) );
+  }
+}
+#ifdef __clang__
+  #pragma clang diagnostic pop
+#endif
+
+int main( int argc, char **argv ) {
+
+  InitGoogleTest( &argc, argv );
+  return RUN_ALL_TESTS();
+}
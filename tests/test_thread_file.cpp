@@ -46,7 +46,10 @@
 #endif
 
 /* stl header */
+#include <atomic>
+#include <chrono>
 #include <filesystem>
+#include <fstream>
 #include <thread>
 
 /* magic enum */
@@ -148,6 +151,8 @@ namespace vx {
     }
     threads.clear();
 
+    /* the file logger buffers, write everything before counting */
+    FlushLogger();
     std::size_t count = TestHelper::countNewLines( tmpFile );
 
     if ( !std::filesystem::remove( tmpFile ) ) {
@@ -159,6 +164,222 @@ namespace vx {
     std::size_t differentLogTypes = magic_enum::enum_count<Severity>() - magic_enum::enum_integer( avoidLogBelow );
     EXPECT_EQ( logMessageCount * differentLogTypes, count );
   }
+
+  TEST( FileT, Reconfigure ) {
+
+    std::error_code errorCode {};
+    std::filesystem::path tmpPath = std::filesystem::temp_directory_path( errorCode );
+    if ( errorCode ) {
+
+      GTEST_FAIL() << "Error getting temp_directory_path: " + errorCode.message() + " Code: " + std::to_string( errorCode.value() );
+    }
+    const std::string firstFile = ( tmpPath / "test-first.log" ).string();
+    const std::string secondFile = ( tmpPath / "test-second.log" ).string();
+
+    ConfigureLogger( { { "type", "file" }, { "filename", firstFile } } );
+
+    unsigned int hardwareThreadCount = std::max<unsigned int>( 1, std::thread::hardware_concurrency() );
+    std::atomic<bool> running { true };
+
+    std::vector<std::thread> threads {};
+    threads.reserve( hardwareThreadCount );
+    for ( unsigned int n = 0; n < hardwareThreadCount; ++n ) {
+
+      threads.emplace_back( std::thread( [ &hardwareThreadCount ] {
+        for ( std::size_t i = 0; i < logMessageCount / hardwareThreadCount; ++i ) {
+
+          LogFatal( std::string( logMessage ) );
+        }
+      } ) );
+    }
+
+    /* switch the sink, while the threads are logging */
+    std::thread reconfigure( [ &running, &firstFile, &secondFile ] {
+      for ( std::size_t i = 0; running.load(); ++i ) {
+
+        ConfigureLogger( { { "type", "file" }, { "filename", i % 2 == 0 ? secondFile : firstFile } } );
+        std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+      }
+    } );
+
+    for ( auto &thread : threads ) {
+
+      thread.join();
+    }
+    threads.clear();
+    running.store( false );
+    reconfigure.join();
+
+    /* close the last file */
+    ConfigureLogger( { { "type", "" } } );
+
+    const std::size_t count = TestHelper::countNewLines( firstFile ) + TestHelper::countNewLines( secondFile );
+
+    if ( !std::filesystem::remove( firstFile ) || !std::filesystem::remove( secondFile ) ) {
+
+      GTEST_FAIL() << "Tmp files cannot be removed: " + firstFile + " " + secondFile;
+    }
+
+    EXPECT_EQ( logMessageCount / hardwareThreadCount * hardwareThreadCount, count );
+  }
+
+  TEST( FileT, Append ) {
+
+    std::error_code errorCode {};
+    std::filesystem::path tmpPath = std::filesystem::temp_directory_path( errorCode );
+    if ( errorCode ) {
+
+      GTEST_FAIL() << "Error getting temp_directory_path: " + errorCode.message() + " Code: " + std::to_string( errorCode.value() );
+    }
+    tmpPath /= logFilename;
+    std::string tmpFile = tmpPath.string();
+    std::cout << tmpFile << std::endl;
+
+    /* small buffers, so the threads append concurrently */
+    ConfigureLogger( { { "type", "file" }, { "filename", tmpFile }, { "mode", "append" }, { "buffer_size", "256" } } );
+
+    unsigned int hardwareThreadCount = std::max<unsigned int>( 1, std::thread::hardware_concurrency() );
+
+    std::vector<std::thread> threads {};
+    threads.reserve( hardwareThreadCount );
+    for ( unsigned int n = 0; n < hardwareThreadCount; ++n ) {
+
+      threads.emplace_back( std::thread( [ &hardwareThreadCount ] {
+        for ( std::size_t i = 0; i < logMessageCount / hardwareThreadCount; ++i ) {
+
+          LogFatal( logMessage );
+          LogError( logMessage );
+          LogWarning( logMessage );
+          LogInfo( logMessage );
+          LogDebug( logMessage );
+          LogVerbose( logMessage );
+        }
+      } ) );
+    }
+    for ( auto &thread : threads ) {
+
+      thread.join();
+    }
+    threads.clear();
+
+    /* the threads have exited, flush writes their remaining records */
+    FlushLogger();
+
+    std::size_t count = 0;
+    std::size_t broken = 0;
+    {
+      std::ifstream file( tmpFile );
+      for ( std::string line {}; std::getline( file, line ); ++count ) {
+
+        if ( !line.ends_with( logMessage ) || line.find( logMessage ) != line.size() - logMessage.size() ) {
+
+          ++broken;
+        }
+      }
+    }
+    ConfigureLogger( { { "type", "" } } );
+
+    if ( !std::filesystem::remove( tmpFile ) ) {
+
+      GTEST_FAIL() << "Tmp file cannot be removed: " + tmpFile;
+    }
+
+    /* Count Severity enum and remove entries we are avoid to log */
+    std::size_t differentLogTypes = magic_enum::enum_count<Severity>() - magic_enum::enum_integer( avoidLogBelow );
+    EXPECT_EQ( logMessageCount / hardwareThreadCount * hardwareThreadCount * differentLogTypes, count );
+    EXPECT_EQ( 0, broken );
+  }
+
+  TEST( FileT, AppendExit ) {
+
+    std::error_code errorCode {};
+    std::filesystem::path tmpPath = std::filesystem::temp_directory_path( errorCode );
+    if ( errorCode ) {
+
+      GTEST_FAIL() << "Error getting temp_directory_path: " + errorCode.message() + " Code: " + std::to_string( errorCode.value() );
+    }
+    tmpPath /= logFilename;
+    std::string tmpFile = tmpPath.string();
+
+    /* the record never expires, only the exit of its thread writes it */
+    std::unique_ptr<Logger> logger = LoggerFactory::instance().produce( { { "type", "file" }, { "filename", tmpFile }, { "mode", "append" }, { "flush_interval", "3600000" } } );
+    std::thread( [ &logger ] { logger->log( logMessage, Severity::Info ); } ).join();
+    std::this_thread::sleep_for( std::chrono::milliseconds( 1500 ) );
+    const std::size_t written = TestHelper::countNewLines( tmpFile );
+    logger.reset();
+
+    if ( !std::filesystem::remove( tmpFile ) ) {
+
+      GTEST_FAIL() << "Tmp file cannot be removed: " + tmpFile;
+    }
+
+    EXPECT_EQ( 1, written );
+  }
+
+  TEST( FileT, Group ) {
+
+    std::error_code errorCode {};
+    std::filesystem::path tmpPath = std::filesystem::temp_directory_path( errorCode );
+    if ( errorCode ) {
+
+      GTEST_FAIL() << "Error getting temp_directory_path: " + errorCode.message() + " Code: " + std::to_string( errorCode.value() );
+    }
+    tmpPath /= logFilename;
+    std::string tmpFile = tmpPath.string();
+    std::cout << tmpFile << std::endl;
+
+    ConfigureLogger( { { "type", "file" }, { "filename", tmpFile }, { "mode", "group" } } );
+
+    /* more threads than cores, so they post while a leader writes */
+    const unsigned int threadCount = std::max<unsigned int>( 4, std::thread::hardware_concurrency() );
+
+    std::vector<std::thread> threads {};
+    threads.reserve( threadCount );
+    for ( unsigned int n = 0; n < threadCount; ++n ) {
+
+      threads.emplace_back( std::thread( [ &threadCount ] {
+        for ( std::size_t i = 0; i < logMessageCount / threadCount; ++i ) {
+
+          LogFatal( logMessage );
+          LogError( logMessage );
+          LogWarning( logMessage );
+          LogInfo( logMessage );
+          LogDebug( logMessage );
+          LogVerbose( logMessage );
+        }
+      } ) );
+    }
+    for ( auto &thread : threads ) {
+
+      thread.join();
+    }
+    threads.clear();
+
+    /* no flush, every record is written, before log returns */
+    std::size_t count = 0;
+    std::size_t broken = 0;
+    {
+      std::ifstream file( tmpFile );
+      for ( std::string line {}; std::getline( file, line ); ++count ) {
+
+        if ( !line.ends_with( logMessage ) || line.find( logMessage ) != line.size() - logMessage.size() ) {
+
+          ++broken;
+        }
+      }
+    }
+    ConfigureLogger( { { "type", "" } } );
+
+    if ( !std::filesystem::remove( tmpFile ) ) {
+
+      GTEST_FAIL() << "Tmp file cannot be removed: " + tmpFile;
+    }
+
+    /* Count Severity enum and remove entries we are avoid to log */
+    std::size_t differentLogTypes = magic_enum::enum_count<Severity>() - magic_enum::enum_integer( avoidLogBelow );
+    EXPECT_EQ( logMessageCount / threadCount * threadCount * differentLogTypes, count );
+    EXPECT_EQ( 0, broken );
+  }
 }
 #ifdef __clang__
   #pragma clang diagnostic pop
@@ -148,6 +148,8 @@ namespace vx {
     }
     threads.clear();
 
+    /* the file logger buffers, write everything before counting */
+    FlushLogger();
     std::size_t count = TestHelper::countNewLines( tmpFile );
 
     if ( !std::filesystem::remove( tmpFile ) ) {
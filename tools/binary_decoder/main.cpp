@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026 Florian Becker <fb@vxapps.com> (VX APPS).
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* stl header */
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+
+/* modern.cpp.logger */
+#include <BinaryDecoder.h>
+
+int main( int argc, char **argv ) {
+
+  if ( argc < 2 || argc > 3 ) {
+
+    std::cout << "Usage: " << argv[ 0 ] << " <binary log> [text log]" << std::endl;
+    std::cout << "Writes the text of the file logger to the text log or to standard out." << std::endl;
+    std::cout << "Timestamps are in the local time zone, set TZ to the one of the writing host." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::ifstream input( argv[ 1 ], std::ifstream::binary );
+  if ( !input ) {
+
+    std::cout << "Cannot open " << argv[ 1 ] << std::endl;
+    return EXIT_FAILURE;
+  }
+  const std::string data { std::istreambuf_iterator<char>( input ), std::istreambuf_iterator<char>() };
+
+  std::string text {};
+  text.reserve( data.size() * 8 );
+  vx::BinaryDecoder decoder {};
+  const bool complete = decoder.decode( data, text );
+
+  if ( argc == 3 ) {
+
+    std::ofstream output( argv[ 2 ], std::ofstream::binary );
+    output << text;
+    if ( !output ) {
+
+      std::cout << "Cannot write " << argv[ 2 ] << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  else {
+
+    std::cout << text << std::flush;
+  }
+
+  if ( !complete ) {
+
+    std::cerr << "Truncated or corrupt frame in " << argv[ 1 ] << ", decoded up to it." << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}